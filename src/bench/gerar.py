@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+# Gerador de programas Maiêutic sintéticos, para medir como o compilador
+# escala com o tamanho do fonte (de 1 KB a 1 GB)
+#
+# Uso:
+#   python3 gerar.py --size=1M -o programa.ms
+#   python3 gerar.py --size=100K --depth=6 --mix=num=1,str=4 --seed=7 > dialogo.ms
+#   python3 gerar.py --lines=50000 -o editor.ms
+#   ../compiler/maieutic --time-passes programa.ms
+#
+# --size     tamanho aproximado do fonte (sufixos K, M e G: potências de 1024)
+# --lines    número aproximado de linhas, em vez do tamanho (--size é ignorado)
+# --depth    profundidade máxima de aninhamento de Se/Enquanto (padrão 3)
+# --mix      peso de cada tipo de comando e literal: num, str, bool, list
+#            (padrão num=4,str=3,bool=1,list=2)
+# --seed     semente do gerador; a mesma semente gera o mesmo programa
+#
+# O programa é escrito em pedaços, sem ficar inteiro na memória. As
+# variáveis de cada tipo são declaradas no começo, e cada Enquanto tem o
+# seu contador: o programa gerado compila e também roda até o fim.
+import random
+import sys
+from typing import Dict, List, TextIO
+
+KINDS = ("num", "str", "bool", "list")
+POOL = 16            # variáveis de cada tipo
+WORDS = ("virtude", "saber", "justiça", "coragem", "amizade", "prazer", "dever", "alma")
+
+
+def parse_size(text: str) -> int:
+    units = {"K": 1 << 10, "M": 1 << 20, "G": 1 << 30}
+    text = text.strip().upper().rstrip("B")
+    if text and text[-1] in units:
+        return int(float(text[:-1]) * units[text[-1]])
+    return int(text)
+
+
+def parse_mix(text: str) -> Dict[str, int]:
+    mix = {kind: 0 for kind in KINDS}
+    for item in text.split(","):
+        kind, _, weight = item.partition("=")
+        if kind not in mix or not weight.isdigit():
+            raise SystemExit(f"[gerar] --mix inválido: {item} (use num=N,str=N,bool=N,list=N)")
+        mix[kind] = int(weight)
+    if not any(mix.values()):
+        raise SystemExit("[gerar] --mix precisa de algum peso maior que zero")
+    return mix
+
+
+class Generator:
+    def __init__(self, out: TextIO, size: int, depth: int, mix: Dict[str, int], seed: int, lines: int = 0):
+        self.out = out
+        self.size = size
+        self.lines = lines
+        self.depth = depth
+        self.kinds = [k for k in KINDS if mix[k]]
+        self.weights = [mix[k] for k in self.kinds]
+        self.rng = random.Random(seed)
+        self.written = 0
+        self.count = 0       # linhas escritas
+        self.loops = 0
+        self.chunk: List[str] = []
+
+    def line(self, indent: int, text: str) -> None:
+        line = " " * indent + text + "\n"
+        self.chunk.append(line)
+        self.written += len(line.encode("utf-8"))
+        self.count += 1
+        if len(self.chunk) >= 4096:
+            self.flush()
+
+    def flush(self) -> None:
+        self.out.write("".join(self.chunk))
+        self.chunk.clear()
+
+    # Expressões de cada tipo; `level` limita o tamanho
+    def num(self, level: int = 2) -> str:
+        r = self.rng.random()
+        if level == 0 or r < 0.3:
+            return str(self.rng.randint(0, 999)) if r < 0.15 else f"@n{self.rng.randrange(POOL)}"
+        if r < 0.4 and "list" in self.kinds:
+            return f"tamanho_de(@l{self.rng.randrange(POOL)})"
+        op = self.rng.choice(("+", "-", "*", "+", "%"))
+        right = str(self.rng.randint(1, 97)) if op == "%" else self.num(level - 1)
+        return f"({self.num(level - 1)} {op} {right})"
+
+    def string(self, level: int = 2) -> str:
+        r = self.rng.random()
+        if level == 0 or r < 0.35:
+            return f'"{self.rng.choice(WORDS)}"' if r < 0.2 else f"@s{self.rng.randrange(POOL)}"
+        if r < 0.7:
+            return f"{self.string(level - 1)} + {self.num(1)}"
+        return f'"{self.rng.choice(WORDS)} e " + {self.string(level - 1)}'
+
+    def boolean(self, level: int = 2) -> str:
+        r = self.rng.random()
+        if level == 0 or r < 0.3:
+            return self.rng.choice(("Verdadeiro", "Falso")) if r < 0.1 else f"@b{self.rng.randrange(POOL)}"
+        if r < 0.8:
+            op = self.rng.choice(("<", "<=", ">", ">=", "==", "!="))
+            return f"{self.num(1)} {op} {self.num(1)}"
+        return f"{self.boolean(level - 1)} {self.rng.choice(('AND', 'OR'))} {self.boolean(level - 1)}"
+
+    def list_literal(self) -> str:
+        items = [self.rng.choice((self.num, self.string))(0) for _ in range(self.rng.randint(0, 4))]
+        return "[" + ", ".join(items) + "]"
+
+    def simple(self, indent: int) -> None:
+        kind = self.rng.choices(self.kinds, self.weights)[0]
+        v = self.rng.randrange(POOL)
+        if kind == "num":
+            self.line(indent, f"@n{v} := {self.num()} % 100000")
+        elif kind == "str":
+            r = self.rng.random()
+            if r < 0.6:
+                # limita o crescimento da string numa execução
+                self.line(indent, f"@s{v} := {self.string()}")
+            else:
+                self.line(indent, f'{self.rng.choice((">>", "!"))} "{self.rng.choice(WORDS)}: " + {self.string(1)}')
+        elif kind == "bool":
+            self.line(indent, f"@b{v} := {self.boolean()}")
+        else:
+            r = self.rng.random()
+            if r < 0.5:
+                self.line(indent, f"@l{v} << {self.rng.choice((self.num, self.string))(1)}")
+            else:
+                self.line(indent, f"@l{v} := {self.list_literal()}")
+
+    def block(self, indent: int, depth: int) -> None:
+        """Um Se (com ou sem Senao) ou um Enquanto de 3 voltas, com o corpo
+        aninhado. A linha em branco indentada no fim fecha o bloco para o
+        lexer (DEDENT e depois NEWLINE)."""
+        inner = indent + 4
+        if self.rng.random() < 0.5:
+            self.line(indent, f"-> Se {self.boolean()}:")
+            self.body(inner, depth + 1)
+            if self.rng.random() < 0.5:
+                self.line(indent, "-> Senao:")
+                self.body(inner, depth + 1)
+        else:
+            counter = f"@i{self.loops}"
+            self.loops += 1
+            self.line(indent, f"{counter} := 0")
+            self.line(indent, f"Enquanto {counter} < 3:")
+            self.body(inner, depth + 1)
+            self.line(inner, f"{counter} := {counter} + 1")
+        self.line(indent, "")
+
+    def body(self, indent: int, depth: int) -> None:
+        for _ in range(self.rng.randint(1, 5)):
+            self.statement(indent, depth)
+
+    def statement(self, indent: int, depth: int) -> None:
+        if depth < self.depth and self.rng.random() < 0.25:
+            self.block(indent, depth)
+        else:
+            self.simple(indent)
+
+    def generate(self) -> None:
+        target = f"~{self.lines} linhas" if self.lines else f"~{self.size} bytes"
+        self.line(0, f"# Programa sintético: gerar.py, {target}")
+        for v in range(POOL):
+            self.line(0, f"@n{v} := {v}")
+            self.line(0, f'@s{v} := "{WORDS[v % len(WORDS)]}"')
+            self.line(0, f"@b{v} := {'Verdadeiro' if v % 2 else 'Falso'}")
+            self.line(0, f"@l{v} := []")
+        while (self.count < self.lines) if self.lines else (self.written < self.size):
+            self.statement(0, 0)
+        self.line(0, '! "Fim do programa sintético"')
+        self.flush()
+
+
+def main():
+    size = 1 << 20
+    depth = 3
+    mix = {"num": 4, "str": 3, "bool": 1, "list": 2}
+    seed = 1
+    lines = 0
+    output = None
+    args = sys.argv[1:]
+    i = 0
+    while i < len(args):
+        arg = args[i]
+        if arg.startswith("--size="):
+            size = parse_size(arg[len("--size="):])
+        elif arg.startswith("--lines="):
+            lines = max(1, int(arg[len("--lines="):]))
+        elif arg.startswith("--depth="):
+            depth = max(0, int(arg[len("--depth="):]))
+        elif arg.startswith("--mix="):
+            mix = parse_mix(arg[len("--mix="):])
+        elif arg.startswith("--seed="):
+            seed = int(arg[len("--seed="):])
+        elif arg == "-o" and i + 1 < len(args):
+            i += 1
+            output = args[i]
+        else:
+            print(f"Uso: {sys.argv[0]} [--size=N[K|M|G] | --lines=N] [--depth=N] [--mix=num=N,str=N,bool=N,list=N]"
+                  " [--seed=N] [-o saida.ms]")
+            sys.exit(1)
+        i += 1
+
+    if output is None:
+        Generator(sys.stdout, size, depth, mix, seed, lines).generate()
+    else:
+        with open(output, "w", encoding="utf-8") as f:
+            Generator(f, size, depth, mix, seed, lines).generate()
+
+
+if __name__ == "__main__":
+    main()
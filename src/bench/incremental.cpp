@@ -0,0 +1,274 @@
+// incremental: confere e mede o parse incremental (IncrementalDocument,
+// ../compiler/incremental.h).
+//
+// Uso:
+//   ./incremental conferir [--edicoes=N] [--semente=S] programa.ms...
+//   ./incremental latencia [--edicoes=N] [--semente=S] programa.ms
+//
+// conferir: aplica edições aleatórias (trechos de código, linhas, aspas e
+// blocos pela metade, apagar várias linhas...) aos programas e, depois de
+// cada uma, compara o documento com o parse do texto inteiro: o mesmo
+// sucesso ou erro, a mesma linha na mensagem de erro e o mesmo assembly
+// gerado, com a tabela de linhas (-g), a menos da numeração dos .SITE, que
+// segue a ordem de análise dos trechos. Sai com 1 na primeira diferença, mostrando o texto.
+//
+// latencia: num programa grande (gerar.py), mede cada tipo de edição em
+// posições aleatórias e mostra a mediana e o p99, ao lado do parse do
+// arquivo inteiro.
+#include "incremental.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Trechos inseridos pelas edições aleatórias: código válido, pedaços que
+// abrem ou fecham blocos e strings, e lixo
+const char* const SNIPPETS[] = {
+    "", "\n", "\n\n", "    ", "\t", "x", "1", "(", ")", ":", "#", "@", "\"", "# comentário\n",
+    "@x := 1", "\n@y := 2\n", "    @z := 3\n", "\n    >> @x\n", "\"a\nb\"",
+    "Enquanto @x < 3:\n    @x := @x + 1\n\n",
+    "-> Se @x > 1:\n    >> 1\n-> Senao:\n    >> 2\n",
+    "-> Senao:\n", "\n-> Senao:\n    >> 9\n",
+};
+
+struct Parsed {
+    bool ok = false;
+    std::string diagnostics;
+    std::string assembly;
+};
+
+std::string readFile(const char* path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "incremental: não foi possível abrir %s\n", path);
+        std::exit(2);
+    }
+    std::stringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+// "na linha N" da mensagem: o "esperando ..." pode mudar (incremental.h)
+std::string errorLine(const std::string& diagnostics) {
+    size_t at = diagnostics.rfind("na linha");
+    return at == std::string::npos ? std::string() : diagnostics.substr(at);
+}
+
+std::string withoutSiteIds(std::string_view assembly) {
+    std::string out;
+    out.reserve(assembly.size());
+    for (size_t at = 0; at < assembly.size();) {
+        size_t end = assembly.find('\n', at);
+        end = end == std::string_view::npos ? assembly.size() : end + 1;
+        std::string_view line = assembly.substr(at, end - at);
+        if (line.substr(0, 6) == ".SITE ") {
+            size_t dot = line.find('.', 6);
+            out += ".SITE ";
+            if (dot != std::string_view::npos) out.append(line.substr(dot));
+            else out += '\n';
+        } else {
+            out.append(line);
+        }
+        at = end;
+    }
+    return out;
+}
+
+// Gera o assembly numa cópia do contexto da análise: os slots, labels e
+// registradores da geração não voltam para o documento. Com -g, as .LINE
+// conferem as linhas dos trechos que mudaram de posição
+std::string generate(const CompileContext& parsed, Block* program) {
+    CompileContext context = parsed;
+    context.ownedNodes = nullptr;
+    context.options.lineTable = true;
+    CompileContext::Scope scope(context);
+    program->collectAliases(context.aliasedLists);
+    AsmEmitter out;
+    program->generate(out);
+    return withoutSiteIds(out.view());
+}
+
+Parsed parseWhole(const std::string& text) {
+    CompileContext context;
+    std::vector<std::unique_ptr<Node>> nodes;
+    context.ownedNodes = &nodes;
+    std::vector<char> buffer(text.begin(), text.end());
+    buffer.push_back('\0');
+    buffer.push_back('\0');
+    Parsed result;
+    result.ok = parseBuffer(context, buffer.data(), buffer.size(), 1);
+    result.diagnostics = context.diagnostics;
+    if (result.ok) result.assembly = generate(context, context.root);
+    return result;
+}
+
+Parsed parseDocument(IncrementalDocument& doc) {
+    Parsed result;
+    result.ok = doc.ok();
+    result.diagnostics = doc.diagnostics();
+    if (result.ok) result.assembly = generate(doc.compileContext(), doc.program());
+    return result;
+}
+
+int check(const std::vector<std::string>& sources, size_t edits, unsigned seed) {
+    std::mt19937 rng(seed);
+    size_t checks = 0;
+    while (checks < edits) {
+        IncrementalDocument doc(sources[rng() % sources.size()]);
+        for (int e = 0; e < 8 && checks < edits; ++e, ++checks) {
+            size_t lines = doc.lineCount();
+            TextPosition from{rng() % lines, rng() % 12}, to = from;
+            if (rng() % 3 == 0) to = TextPosition{std::min(lines - 1, from.line + rng() % 3), rng() % 12};
+            doc.edit(from, to, SNIPPETS[rng() % (sizeof SNIPPETS / sizeof *SNIPPETS)]);
+
+            std::string text = doc.text();
+            Parsed whole = parseWhole(text);
+            Parsed incremental = parseDocument(doc);
+            const char* what = nullptr;
+            if (incremental.ok != whole.ok) what = "sucesso do parse";
+            else if (errorLine(incremental.diagnostics) != errorLine(whole.diagnostics)) what = "linha do erro";
+            else if (incremental.assembly != whole.assembly) what = "assembly gerado";
+            if (what) {
+                std::printf("FALHOU  %s, depois de %zu edições\n--- texto\n%s\n--- arquivo inteiro\n%s--- incremental\n%s",
+                            what, checks + 1, text.c_str(), whole.diagnostics.c_str(), incremental.diagnostics.c_str());
+                return 1;
+            }
+        }
+    }
+    std::printf("ok      %zu edições aleatórias iguais ao parse do arquivo inteiro\n", checks);
+    return 0;
+}
+
+double microseconds(const std::function<void()>& run) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* name, std::vector<double>& times, double lines) {
+    std::sort(times.begin(), times.end());
+    double median = times[times.size() / 2];
+    double p99 = times[std::min(times.size() - 1, times.size() * 99 / 100)];
+    std::printf("%10.1f %12.1f %12.1f  %s\n", lines, median, p99, name);
+}
+
+int latency(const std::string& source, size_t edits, unsigned seed) {
+    std::mt19937 rng(seed);
+    IncrementalDocument doc(source);
+    std::printf("%zu linhas, %zu trechos, %zu edições de cada tipo\n", doc.lineCount(), doc.chunkCount(), edits);
+    std::printf("%10s %12s %12s  %s\n", "linhas", "mediana µs", "p99 µs", "operação");
+
+    std::vector<double> whole;
+    for (int i = 0; i < 5; ++i) {
+        std::vector<char> buffer(source.begin(), source.end());
+        buffer.push_back('\0');
+        buffer.push_back('\0');
+        CompileContext context;
+        std::vector<std::unique_ptr<Node>> nodes;
+        context.ownedNodes = &nodes;
+        whole.push_back(microseconds([&] { parseBuffer(context, buffer.data(), buffer.size(), 1); }));
+    }
+    report("parse do arquivo inteiro", whole, (double)doc.lineCount());
+
+    // Cada edição é desfeita logo depois (fora da medição): o texto do
+    // documento é sempre o do arquivo, e as linhas dele servem para sortear
+    // posições na margem (comandos do nível 0) ou dentro de um bloco
+    std::vector<std::string_view> lines;
+    for (size_t at = 0; at <= source.size();) {
+        size_t end = std::min(source.find('\n', at), source.size());
+        lines.push_back(std::string_view(source).substr(at, end - at));
+        at = end + 1;
+    }
+    auto pick = [&](bool indented) {
+        for (;;) {
+            size_t line = rng() % lines.size();
+            std::string_view text = lines[line];
+            if (text.size() < 8 || text.find('#') != std::string_view::npos) continue;
+            if ((text[0] == ' ') == indented) return line;
+        }
+    };
+
+    struct Kind {
+        const char* name;
+        bool indented;
+        TextPosition from, to;   // coluna ou linha relativas à sorteada
+        const char* text;
+    };
+    const Kind kinds[] = {
+        {"um caractere num comando do nível 0", false, {0, 1}, {0, 1}, "x"},
+        {"um caractere dentro de um bloco", true, {0, 5}, {0, 5}, "1"},
+        {"inserir uma linha", true, {0, 0}, {0, 0}, "    @novo := 1\n"},
+        {"apagar uma linha", true, {0, 0}, {1, 0}, ""},
+    };
+    for (const Kind& kind : kinds) {
+        std::vector<double> times;
+        double reparsed = 0;
+        for (size_t i = 0; i < edits; ++i) {
+            size_t line = pick(kind.indented);
+            TextPosition from{line + kind.from.line, kind.from.column}, to{line + kind.to.line, kind.to.column};
+            EditStats stats;
+            times.push_back(microseconds([&] { stats = doc.edit(from, to, kind.text); }));
+            reparsed += (double)stats.reparsedLines;
+
+            // Desfaz: o texto trocado volta, e o que foi inserido sai
+            std::string removed = to.line > from.line ? std::string(lines[line]) + "\n"
+                                                      : std::string(lines[line].substr(from.column, to.column - from.column));
+            size_t added = std::count(kind.text, kind.text + std::strlen(kind.text), '\n');
+            TextPosition end{from.line + added, added ? 0 : from.column + std::strlen(kind.text)};
+            doc.edit(from, end, removed);
+        }
+        report(kind.name, times, reparsed / (double)edits);
+    }
+
+    std::vector<double> diagnostics, program;
+    for (size_t i = 0; i < std::min<size_t>(edits, 20); ++i) {
+        size_t line = pick(true);
+        doc.edit({line, 5}, {line, 5}, "1");
+        diagnostics.push_back(microseconds([&] { doc.diagnostics(); }));
+        program.push_back(microseconds([&] { doc.program(); }));
+        doc.edit({line, 5}, {line, 6}, "");
+    }
+    report("diagnostics()", diagnostics, 0);
+    report("program() depois de uma edição", program, 0);
+
+    if (doc.text() != source) {
+        std::printf("FALHOU  o documento não voltou ao texto do arquivo\n");
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3 || (std::strcmp(argv[1], "conferir") != 0 && std::strcmp(argv[1], "latencia") != 0)) {
+        std::fprintf(stderr, "Uso: %s conferir [--edicoes=N] [--semente=S] programa.ms...\n"
+                             "     %s latencia [--edicoes=N] [--semente=S] programa.ms\n", argv[0], argv[0]);
+        return 2;
+    }
+    bool checking = std::strcmp(argv[1], "conferir") == 0;
+    size_t edits = checking ? 24000 : 200;
+    unsigned seed = 7;
+    std::vector<std::string> sources;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--edicoes=", 10) == 0) edits = std::strtoul(argv[i] + 10, nullptr, 10);
+        else if (std::strncmp(argv[i], "--semente=", 10) == 0) seed = (unsigned)std::strtoul(argv[i] + 10, nullptr, 10);
+        else sources.push_back(readFile(argv[i]));
+    }
+    if (sources.empty() || edits == 0) {
+        std::fprintf(stderr, "incremental: nenhum programa ou nenhuma edição\n");
+        return 2;
+    }
+    return checking ? check(sources, edits, seed) : latency(sources[0], edits, seed);
+}
@@ -0,0 +1,63 @@
+// medir: roda um comando e grava o tempo de parede, o pico de memória
+// residente e o código de saída dele, para o run.py.
+//
+// Uso:
+//   ./medir resultado.txt comando [argumentos...]
+//
+// O pico de memória (ru_maxrss) de um processo inclui o do processo que o
+// criou até o exec; medido direto do Python, nenhum comando ficaria abaixo
+// dos ~14 MB do próprio interpretador. Este programa é pequeno o bastante
+// para não esconder o pico de quem ele roda.
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Uso: %s resultado.txt comando [argumentos...]\n", argv[0]);
+        return 2;
+    }
+
+    timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::perror("medir: fork");
+        return 2;
+    }
+    if (pid == 0) {
+        execvp(argv[2], argv + 2);
+        std::fprintf(stderr, "medir: %s: %s\n", argv[2], std::strerror(errno));
+        _exit(127);
+    }
+
+    int status = 0;
+    rusage usage{};
+    while (wait4(pid, &status, 0, &usage) < 0) {
+        if (errno != EINTR) {
+            std::perror("medir: wait4");
+            return 2;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wall = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    std::FILE* out = std::fopen(argv[1], "w");
+    if (!out) {
+        std::perror("medir: resultado");
+        return 2;
+    }
+#ifdef __APPLE__
+    long rssKb = usage.ru_maxrss / 1024;   // bytes no macOS
+#else
+    long rssKb = usage.ru_maxrss;          // KB no Linux
+#endif
+    std::fprintf(out, "%.6f %ld %d\n", wall, rssKb, code);
+    std::fclose(out);
+    return 0;
+}
@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+# Benchmarks de ponta a ponta do Maiêutic
+#
+# Uso:
+#   python3 run.py                          # todas as cargas, tamanho padrão
+#   python3 run.py --scale=0.1 primos       # só primos, com 1/10 do tamanho
+#   python3 run.py --json=resultados.json   # grava também o JSON
+#
+# Cada carga (*.ms desta pasta) começa com "@n := <tamanho>"; o tamanho é
+# multiplicado por --scale. Para cada carga são medidas as fases:
+#   compile    maieutic fonte.ms saida.asm
+#   interp     maieutic --run fonte.ms       (interpretador da AST, com JIT)
+#   vm-py      python3 socraticvm.py saida.asm
+#   vm-native  ./socraticvm saida.asm
+# com o tempo de parede (melhor de --repeat execuções), as instruções da VM
+# por segundo e o pico de memória residente do processo (medido por
+# ./medir, ver medir.cpp). A saída do programa tem de ser a mesma no
+# interpretador e nas duas VMs.
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+import time
+from datetime import datetime, timezone
+from typing import Dict, List, Optional
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+MEDIR = os.path.join(HERE, "medir")
+PHASES = ("compile", "interp", "vm-py", "vm-native")
+SIZE_LINE = re.compile(r"^@n := (\d+)$", re.MULTILINE)
+
+
+class Run:
+    def __init__(self, wall: float, rss_kb: int, stdout: bytes, stderr: bytes, status: int):
+        self.wall = wall
+        self.rss_kb = rss_kb
+        self.stdout = stdout
+        self.stderr = stderr
+        self.status = status
+
+
+def measure(command: List[str]) -> Run:
+    """Roda um processo, com tempo de parede e pico de memória."""
+    with tempfile.TemporaryFile() as out, tempfile.TemporaryFile() as err:
+        if os.path.exists(MEDIR):
+            with tempfile.NamedTemporaryFile("r", suffix=".txt") as result:
+                subprocess.run([MEDIR, result.name] + command, stdin=subprocess.DEVNULL,
+                               stdout=out, stderr=err, check=True)
+                wall, rss, status = result.read().split()
+                wall, rss, status = float(wall), int(rss), int(status)
+        else:
+            # sem ./medir, o pico inclui a memória deste Python (run.py avisa)
+            start = time.perf_counter()
+            _, wait_status, usage = os.wait4(subprocess.Popen(
+                command, stdin=subprocess.DEVNULL, stdout=out, stderr=err).pid, 0)
+            wall = time.perf_counter() - start
+            status = os.waitstatus_to_exitcode(wait_status)
+            rss = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+        out.seek(0)
+        err.seek(0)
+        return Run(wall, rss, out.read(), err.read(), status)
+
+
+def best_of(command: List[str], repeat: int) -> Run:
+    runs = [measure(command) for _ in range(repeat)]
+    failed = [r for r in runs if r.status != 0]
+    if failed:
+        return failed[0]
+    best = min(runs, key=lambda r: r.wall)
+    best.rss_kb = max(r.rss_kb for r in runs)
+    return best
+
+
+def count_instructions(vm: str, asm: str) -> Optional[int]:
+    """Instruções executadas, pelo --stats da VM nativa (fora da medição)."""
+    if not os.path.exists(vm):
+        return None
+    run = measure([vm, asm, "--stats=0"])
+    found = re.search(rb"instru\xc3\xa7\xc3\xb5es executadas: (\d+)", run.stderr)
+    return int(found.group(1)) if found else None
+
+
+def git_commit() -> Optional[str]:
+    try:
+        return subprocess.run(["git", "rev-parse", "--short", "HEAD"], cwd=HERE, capture_output=True,
+                              text=True, check=True).stdout.strip() or None
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def bench_workload(name: str, options: Dict, workdir: str) -> List[Dict]:
+    with open(os.path.join(HERE, name + ".ms"), encoding="utf-8") as f:
+        text = f.read()
+    found = SIZE_LINE.search(text)
+    if not found:
+        raise SystemExit(f"[bench] {name}.ms: falta a linha '@n := <tamanho>'")
+    n = max(1, int(int(found.group(1)) * options["scale"]))
+    source = os.path.join(workdir, name + ".ms")
+    asm = os.path.join(workdir, name + ".asm")
+    with open(source, "w", encoding="utf-8") as f:
+        f.write(SIZE_LINE.sub(f"@n := {n}", text, count=1))
+
+    commands = {
+        "compile": [options["maieutic"], source, asm],
+        "interp": [options["maieutic"], "--run", source],
+        "vm-py": [sys.executable, options["vm_py"], asm],
+        "vm-native": [options["vm"], asm],
+    }
+    results = []
+    instructions = None
+    outputs = {}
+    for phase in PHASES:
+        if phase in options["skip"]:
+            continue
+        if phase == "vm-native" and not os.path.exists(options["vm"]):
+            print(f"[bench] {name}: {options['vm']} não encontrado, vm-native ignorada", file=sys.stderr)
+            continue
+        run = best_of(commands[phase], options["repeat"])
+        if run.status != 0:
+            message = run.stderr.decode("utf-8", "replace").strip() or run.stdout.decode("utf-8", "replace").strip()
+            raise SystemExit(f"[bench] {name} ({phase}) falhou com código {run.status}: {message}")
+        if phase == "compile":
+            instructions = count_instructions(options["vm"], asm)
+        else:
+            outputs[phase] = run.stdout
+        # o interpretador faz o mesmo trabalho que a VM: a taxa dele usa as
+        # instruções que a VM executaria
+        rate = instructions / run.wall if instructions is not None and phase != "compile" and run.wall > 0 else None
+        results.append({
+            "workload": name,
+            "n": n,
+            "phase": phase,
+            "wall_s": round(run.wall, 6),
+            "instructions": instructions if phase != "compile" else None,
+            "instr_per_s": round(rate) if rate is not None else None,
+            "peak_rss_kb": run.rss_kb,
+        })
+        if phase == "compile" and not os.path.exists(asm):
+            raise SystemExit(f"[bench] {name}: o compilador não gerou {asm}")
+
+    if len(set(outputs.values())) > 1:
+        raise SystemExit(f"[bench] {name}: a saída difere entre {', '.join(outputs)}")
+    return results
+
+
+def print_table(results: List[Dict]) -> None:
+    print(f"{'carga':<12} {'n':>9} {'fase':<10} {'tempo (s)':>10} {'instr/s':>14} {'RSS (KB)':>10}")
+    for r in results:
+        rate = f"{r['instr_per_s']:,}".replace(",", ".") if r["instr_per_s"] is not None else "-"
+        print(f"{r['workload']:<12} {r['n']:>9} {r['phase']:<10} {r['wall_s']:>10.4f} {rate:>14} {r['peak_rss_kb']:>10}")
+
+
+def main():
+    options = {
+        "scale": 1.0,
+        "repeat": 3,
+        "skip": set(),
+        "json": None,
+        "maieutic": os.path.join(HERE, "..", "compiler", "maieutic"),
+        "vm": os.path.join(HERE, "..", "vm", "socraticvm"),
+        "vm_py": os.path.join(HERE, "..", "vm", "socraticvm.py"),
+    }
+    workloads = []
+    for arg in sys.argv[1:]:
+        if arg.startswith("--scale="):
+            options["scale"] = float(arg[len("--scale="):])
+        elif arg.startswith("--repeat="):
+            options["repeat"] = max(1, int(arg[len("--repeat="):]))
+        elif arg.startswith("--skip="):
+            options["skip"] = set(arg[len("--skip="):].split(","))
+        elif arg.startswith("--json="):
+            options["json"] = arg[len("--json="):]
+        elif arg.startswith("--maieutic="):
+            options["maieutic"] = arg[len("--maieutic="):]
+        elif arg.startswith("--vm="):
+            options["vm"] = arg[len("--vm="):]
+        elif arg.startswith("-"):
+            print(f"Uso: {sys.argv[0]} [--scale=F] [--repeat=K] [--skip=fase,...] [--json=arquivo]"
+                  " [--maieutic=compilador] [--vm=socraticvm] [carga ...]")
+            print(f"     fases: {', '.join(PHASES)}")
+            sys.exit(1)
+        else:
+            workloads.append(arg[:-3] if arg.endswith(".ms") else arg)
+
+    unknown = options["skip"] - set(PHASES)
+    if unknown:
+        raise SystemExit(f"[bench] fase desconhecida: {', '.join(sorted(unknown))}")
+    if not workloads:
+        workloads = sorted(f[:-3] for f in os.listdir(HERE) if f.endswith(".ms"))
+    if not os.path.exists(options["maieutic"]):
+        raise SystemExit(f"[bench] compilador não encontrado: {options['maieutic']}")
+    if not os.path.exists(MEDIR):
+        print("[bench] ./medir não encontrado (make medir): o pico de memória inclui o do run.py",
+              file=sys.stderr)
+
+    results = []
+    with tempfile.TemporaryDirectory(prefix="maieutic-bench-") as workdir:
+        for name in workloads:
+            results.extend(bench_workload(name, options, workdir))
+    print_table(results)
+
+    if options["json"]:
+        report = {
+            "suite": "maieutic-bench",
+            "version": 1,
+            "date": datetime.now(timezone.utc).isoformat(timespec="seconds"),
+            "commit": git_commit(),
+            "machine": {
+                "system": platform.system(),
+                "arch": platform.machine(),
+                "python": platform.python_version(),
+            },
+            "scale": options["scale"],
+            "repeat": options["repeat"],
+            "results": results,
+        }
+        with open(options["json"], "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2, ensure_ascii=False)
+            f.write("\n")
+        print(f"[bench] Resultados gravados em {options['json']}")
+
+
+if __name__ == "__main__":
+    main()
@@ -5,29 +5,64 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <memory>
 #include <cmath>
 #include <algorithm>
-#include <iomanip>
-#include <ostream>
+#include <fstream>
+#include <sstream>
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+#include "emitter.h"
+#include "jit.h"
+#include "maieutic_io.h"
 
 struct Value;
 using ValueList = std::vector<Value>;
 
-// Helpers para geração de código ASM
-inline int nextLabelId() {
-    static int current = 0;
-    return current++;
-}
+// Nome de variável internado: índice em CompileContext::symbolNames
+using Symbol = int;
+
+// Texto de um token (LIT_STRING) apontando para o fonte, sem cópia. Só vale
+// durante o parse: o scanner lê o fonte no lugar (yy_scan_buffer).
+struct TokenText {
+    const char* begin;
+    size_t length;
+    std::string_view view() const { return std::string_view(begin, length); }
+};
+
+// Perfil de execução (maieutic --profile-use), gravado por
+// socraticvm.py --profile-out: contadores agregados por site
+struct SiteProfile {
+    long count = 0;       // execuções da instrução marcada
+    long whenTrue = 0;    // salto condicional: condição verdadeira
+    long whenFalse = 0;   //                    condição falsa
+};
+
+// Opções de geração de código (linha de comando do maieutic)
+struct CodegenOptions {
+    int unrollFactor = 4;        // cópias do corpo em laços contados (1 = não desenrola)
+    int unrollMaxInstrs = 256;   // limite de instruções do corpo desenrolado
+    bool lineTable = false;      // -g: tabela de linhas do fonte (.FILE/.LINE) no ASM
+};
+
+// Registradores para temporários da geração de código. Os dois primeiros
+// são reg0/reg1 da VM; os demais viram slots ocultos (%r2, %r3, ...), que
+// na VM custam o mesmo que um registrador.
+struct RegisterAllocator {
+    static const int VM_REGS = 2;
+    std::vector<bool> busy = std::vector<bool>(VM_REGS, false);
 
-inline std::string escapeString(const std::string& s) {
-    std::string out;
-    for (char c : s) {
-        if (c == '"' || c == '\\') out.push_back('\\');
-        out.push_back(c);
+    int acquire() {
+        for (size_t r = 0; r < busy.size(); ++r) {
+            if (!busy[r]) { busy[r] = true; return (int)r; }
+        }
+        busy.push_back(true);
+        return (int)busy.size() - 1;
     }
-    return out;
-}
+    void release(int r) { busy[r] = false; }
+};
 
 struct Value {
     enum Type { NIL, BOOL, NUMBER, STRING, LIST } type;
@@ -41,6 +76,7 @@ struct Value {
     Value(bool b) : type(BOOL), boolVal(b), numVal(0) {}
     Value(double n) : type(NUMBER), numVal(n), boolVal(false) {}
     Value(const std::string& s) : type(STRING), strVal(s), numVal(0), boolVal(false) {}
+    Value(std::string&& s) : type(STRING), strVal(std::move(s)), numVal(0), boolVal(false) {}
     Value(const char* s) : type(STRING), strVal(s), numVal(0), boolVal(false) {}
     Value(ValueList l) : type(LIST), listVal(std::make_shared<ValueList>(l)), numVal(0), boolVal(false) {}
 
@@ -67,160 +103,722 @@ struct Value {
     }
 };
 
-inline std::map<std::string, Value> globals;
+// JIT do interpretador (modo --run): um laço Enquanto que dá mais de
+// `threshold` voltas é compilado para x86-64 se só usar números (variáveis,
+// literais, aritmética, comparações, AND/OR, Se e Enquanto aninhados).
+struct JitOptions {
+    bool enabled = true;
+    long threshold = 1000;   // voltas antes de compilar (0: já na entrada do laço)
+};
+
+class Node;
+class Block;
+class ImportStmt;
+class Expression;
+
+// Estado de uma compilação: pilha de indentação do lexer, AST, contadores de
+// labels e sites, tabela de slots, registradores, perfil e as variáveis do
+// interpretador. Nada disso é global, então compilações diferentes podem
+// rodar ao mesmo tempo em threads diferentes, cada uma com o seu contexto.
+struct CompileContext {
+    CodegenOptions options;
+    JitOptions jit;
+
+    std::vector<int> indentStack{0};   // larguras de indentação abertas (lexer)
+    Block* root = nullptr;             // programa, preenchido pelo parser
+
+    // Quando não nulo, todo nó construído é guardado aqui: no parse
+    // incremental (incremental.h) cada trecho do fonte é dono dos nós que
+    // criou e os libera ao ser reanalisado. Na compilação normal a AST vive
+    // até o fim do processo e ninguém libera nada.
+    std::vector<std::unique_ptr<Node>>* ownedNodes = nullptr;
+
+    int labels = 0;
+    int sites = 0;
+
+    // Nomes de variáveis internados pelo lexer: cada nome distinto é guardado
+    // uma vez (deque: endereços estáveis para as chaves de symbolIds) e os
+    // tokens e nós da AST usam o id
+    std::deque<std::string> symbolNames;
+    std::unordered_map<std::string_view, Symbol> symbolIds;
+    std::vector<int> symbolSlots;      // slot de cada símbolo no ASM (-1: ainda sem)
+
+    // Tabela de símbolos do código gerado: cada variável recebe um slot numérico
+    // na ordem em que aparece, e o ASM passa a usar LOAD_SLOT/STORE_SLOT <n>.
+    std::map<std::string, int> slotTable;
+    std::vector<std::string> slotNames;
+
+    RegisterAllocator registers;
+
+    // Tabela de linhas (-g): linhas dos comandos que contêm o código sendo
+    // gerado, do mais externo ao mais interno
+    std::vector<int> lineChain;
+
+    // Variáveis cuja lista pode ser alcançada por outro nome (copiada para outra
+    // variável ou guardada dentro de uma lista). Preenchida por collectAliases()
+    // antes da geração de código; para as demais, só o próprio nome altera o
+    // tamanho da lista.
+    std::set<Symbol> aliasedLists;
+
+    std::map<std::string, SiteProfile> siteProfiles;
+    std::string profileSource;   // "source <hash>" do perfil: o fonte que o gerou
+
+    // Código frio: braços de Se que o perfil mostra pouco executados. Vai para
+    // depois do HALT, para que o braço quente siga sem nenhum salto.
+    AsmEmitter coldCode{4096};
+
+    std::unordered_map<Symbol, Value> globals;   // variáveis do interpretador (--run)
+
+    std::string diagnostics;   // erros e avisos do lexer/parser, impressos pelo chamador
+
+    Symbol intern(std::string_view name) {
+        auto it = symbolIds.find(name);
+        if (it != symbolIds.end()) return it->second;
+        Symbol id = (Symbol)symbolNames.size();
+        symbolNames.emplace_back(name);
+        symbolIds.emplace(symbolNames.back(), id);
+        symbolSlots.push_back(-1);
+        return id;
+    }
+
+    const std::string& nameOf(Symbol s) const { return symbolNames[s]; }
+
+    bool loadProfile(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) return false;
+        std::string line;
+        while (std::getline(in, line)) {
+            std::istringstream fields(line);
+            std::string kind, key;
+            SiteProfile p;
+            if (!(fields >> kind >> key)) continue;
+            if (kind == "source") profileSource = key;
+            else if (kind == "site" && fields >> p.count >> p.whenTrue >> p.whenFalse) siteProfiles[key] = p;
+        }
+        return true;
+    }
+
+    // Torna este o contexto da thread atual enquanto o Scope existir: é por
+    // ele que os nós da AST (construídos pelo parser e gerados depois) chegam
+    // ao estado da compilação sem receber o contexto em cada chamada.
+    class Scope {
+        CompileContext* previous;
+    public:
+        explicit Scope(CompileContext& c);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+};
+
+inline thread_local CompileContext* currentContext = nullptr;
+
+inline CompileContext::Scope::Scope(CompileContext& c) : previous(currentContext) { currentContext = &c; }
+inline CompileContext::Scope::~Scope() { currentContext = previous; }
+
+inline CompileContext& ctx() { return *currentContext; }
+
+// Helpers para geração de código ASM
+inline int nextLabelId() {
+    return ctx().labels++;
+}
+
+// Sites de perfil: cada Se e Enquanto recebe um id na construção, na ordem
+// do fonte, e o marca no ASM com ".SITE ifN" / ".SITE whileN". O id não
+// depende das opções de geração, então o perfil de uma compilação vale
+// para a próxima compilação do mesmo fonte; editar o fonte muda os ids, e
+// por isso o perfil traz o hash do fonte (.SOURCE_HASH) e só é usado com
+// ele.
+inline int nextSiteId() {
+    return ctx().sites++;
+}
+
+inline const SiteProfile* profileOf(const std::string& key) {
+    auto& profiles = ctx().siteProfiles;
+    auto it = profiles.find(key);
+    return it == profiles.end() ? nullptr : &it->second;
+}
+
+inline int slotOf(const std::string& name) {
+    CompileContext& c = ctx();
+    auto it = c.slotTable.find(name);
+    if (it != c.slotTable.end()) return it->second;
+    int slot = (int)c.slotNames.size();
+    c.slotTable[name] = slot;
+    c.slotNames.push_back(name);
+    return slot;
+}
+
+inline int slotOf(Symbol symbol) {
+    int& slot = ctx().symbolSlots[symbol];
+    if (slot < 0) slot = slotOf(ctx().nameOf(symbol));
+    return slot;
+}
+
+inline void emitPopToReg(AsmEmitter& out, int r) {
+    if (r < RegisterAllocator::VM_REGS) out.put("MOV_TOP_R").put(r).put('\n');
+    else out.put("STORE_SLOT ").put(slotOf("%r" + std::to_string(r))).put('\n');
+}
+
+inline void emitPushReg(AsmEmitter& out, int r) {
+    if (r < RegisterAllocator::VM_REGS) out.put("PUSH_R").put(r).put('\n');
+    else out.put("LOAD_SLOT ").put(slotOf("%r" + std::to_string(r))).put('\n');
+}
+
+// Geração de C++ (maieutic --emit=c) sobre o runtime src/runtime/maieutic_rt.h.
+// Cada subexpressão é calculada num temporário próprio, na ordem em que a VM
+// empilharia os valores, para que avisos como "[VM] Divisão por zero" saiam
+// na mesma ordem. Variáveis viram globais v<slot>.
+struct CGen {
+    AsmEmitter& out;
+    AsmEmitter& constants;   // strings literais, declaradas antes do main()
+    int depth = 1;
+    int temps = 0;
+    int strings = 0;
+
+    CGen(AsmEmitter& o, AsmEmitter& k) : out(o), constants(k) {}
+
+    AsmEmitter& line() {
+        for (int i = 0; i < depth; ++i) out.put("    ");
+        return out;
+    }
+
+    // Declara "rt::Value tN = " e devolve o nome; o chamador completa a linha
+    std::string temp() {
+        std::string name = "t" + std::to_string(temps++);
+        line().put("rt::Value ").put(name).put(" = ");
+        return name;
+    }
+
+    std::string var(Symbol name) { return "v" + std::to_string(slotOf(name)); }
+
+    // Operando consumido: temporários são usados uma única vez e podem ser movidos
+    std::string take(const std::string& operand) {
+        return operand[0] == 't' ? "std::move(" + operand + ")" : operand;
+    }
+};
+
+// Tipo do valor de uma expressão no código compilado (em xmm0, BOOL vale 0.0/1.0)
+enum class JitType { NONE, NUMBER, BOOL };
+
+// Compilação de um laço: cada variável vira o endereço fixo do seu numVal
+// nas variáveis do contexto e uma guarda de tipo (NUMBER) verificada na entrada.
+struct JitContext {
+    X64Emitter& code;
+    std::vector<Value*> guards;
+    bool pending = false;    // variável ausente ou não numérica: tentar mais tarde
+
+    explicit JitContext(X64Emitter& c) : code(c) {}
+
+    double* slot(Symbol name) {
+        static double unused;
+        auto it = ctx().globals.find(name);
+        if (it == ctx().globals.end() || it->second.type != Value::NUMBER) {
+            pending = true;
+            return &unused;
+        }
+        Value* v = &it->second;
+        if (std::find(guards.begin(), guards.end(), v) == guards.end()) guards.push_back(v);
+        return &v->numVal;
+    }
+};
+
+// Chamadas do código compilado para operações que ficam em C++
+inline double jitFmod(double a, double b) { return std::fmod(a, b); }
+inline double jitNotEqual(double a, double b) {
+    // Inteiros (até 1e15) têm o mesmo texto só se forem iguais, inclusive no sinal do zero
+    if (a == std::trunc(a) && b == std::trunc(b) && std::fabs(a) < 1e15 && std::fabs(b) < 1e15) {
+        return (a == b && std::signbit(a) == std::signbit(b)) ? 0.0 : 1.0;
+    }
+    return Value(a).toString() != Value(b).toString() ? 1.0 : 0.0;
+}
+
+// Escritas feitas por um trecho de código (corpo de laço), para as análises
+// de invariância da geração de código.
+struct WriteSet {
+    std::set<Symbol> vars;      // reatribuídas: ":=", "<<" e ">"
+    std::set<Symbol> indexed;   // alvo de "@l[i] :="
+    bool appends = false;            // algum "<<"
+    bool unknown = false;            // Importar: o módulo pode alterar qualquer variável
+
+    bool has(Symbol name) const { return unknown || vars.count(name) != 0; }
+    // Conteúdo de listas pode mudar também através de apelidos
+    bool mutatesLists() const { return unknown || appends || !indexed.empty(); }
+};
 
 class Node {
 public:
+    Node() {
+        if (currentContext && currentContext->ownedNodes) currentContext->ownedNodes->emplace_back(this);
+    }
     virtual ~Node() = default;
+
+    int line = 0;   // comandos: linha do fonte em que começam (0: sem linha)
+
     virtual Value execute() = 0;                 // interpretador
-    virtual void generate(std::ostream& out) = 0; // compilador para ASM
+    virtual void generate(AsmEmitter& out) = 0;  // compilador para ASM
+    virtual void generateC(CGen& c) {}           // compilador para C++ (--emit=c)
+    virtual bool compileJit(JitContext& jit) { return false; }  // JIT; false: não suportado
+
+    // Variáveis que o nó pode modificar (atribuição, append, input)
+    virtual void collectWrites(WriteSet& written) {}
+
+    // Variáveis cuja lista passa a ser compartilhada (ver aliasedLists)
+    virtual void collectAliases(std::set<Symbol>& aliased) {}
+    // Comandos Importar, fora dos módulos importados
+    virtual void collectImports(std::vector<ImportStmt*>& imports) {}
+
+    // Comandos do corpo de um laço: as subexpressões que o corpo (`written`)
+    // não altera, para irem para registradores antes do laço
+    virtual void collectHoistable(const WriteSet& written, std::vector<Expression*>& out) {}
 };
 
-class Expression : public Node {};
+class Expression : public Node {
+public:
+    int reg = -1;  // registrador que já contém o valor (-1: calcular)
+
+    // Sem efeitos colaterais e com valor que o trecho `written` não altera
+    virtual bool isInvariant(const WriteSet& written) const { return false; }
+
+    // Idem, quando só o valor numérico interessa (SUB, MUL, MOD, CMP_LT...):
+    // o num_val de uma lista não depende do seu conteúdo
+    virtual bool isNumericInvariant(const WriteSet& written) const { return isInvariant(written); }
+
+    // Coleta as maiores subexpressões invariantes que compensam um registrador
+    virtual void findHoistable(const WriteSet& written, std::vector<Expression*>& out) {}
+
+    // Variáveis cuja lista pode ser o próprio valor da expressão (ou ficar
+    // guardada nele), isto é, que escapam quando o valor é armazenado
+    virtual void collectEscapes(std::set<Symbol>& escaped) const {}
+
+    // Emite o cálculo da expressão e devolve o operando C++ com o resultado
+    // (temporário, variável ou constante)
+    virtual std::string expressionC(CGen& c) = 0;
+
+    // Tipo no código do JIT (NONE: a expressão não pode ser compilada)
+    virtual JitType jitType() const { return JitType::NONE; }
+};
 
 // -------------------- Literais, variáveis e listas --------------------
 
 class Literal : public Expression {
     Value val;
 public:
-    Literal(Value v) : val(v) {}
+    Literal(Value v) : val(std::move(v)) {}
     Value execute() override { return val; }
 
-    void generate(std::ostream& out) override {
+    const Value& value() const { return val; }
+
+    bool isInvariant(const WriteSet& written) const override {
+        return val.type != Value::LIST;
+    }
+
+    void generate(AsmEmitter& out) override {
         switch (val.type) {
         case Value::BOOL:
-            out << "PUSH_BOOL " << (val.boolVal ? 1 : 0) << "\n";
+            out.put(val.boolVal ? "PUSH_BOOL 1\n" : "PUSH_BOOL 0\n");
             break;
         case Value::NUMBER:
-            out << "PUSH_NUM " << std::setprecision(15) << val.numVal << "\n";
+            out.put("PUSH_NUM ").number(val.numVal).put('\n');
             break;
         case Value::STRING:
-            out << "PUSH_STR \"" << escapeString(val.strVal) << "\"\n";
+            out.put("PUSH_STR ").quoted(val.strVal).put('\n');
             break;
         case Value::LIST:
-            out << "; TODO: literal de lista pré-avaliada\n";
-            out << "PUSH_NIL\n";
+            out.put("; TODO: literal de lista pré-avaliada\n");
+            out.put("PUSH_NIL\n");
             break;
         case Value::NIL:
         default:
-            out << "PUSH_NIL\n";
+            out.put("PUSH_NIL\n");
             break;
         }
     }
+
+    std::string expressionC(CGen& c) override {
+        switch (val.type) {
+        case Value::BOOL:
+            return val.boolVal ? "rt::boolean(true)" : "rt::boolean(false)";
+        case Value::NUMBER: {
+            if (!std::isfinite(val.numVal)) return "rt::num(HUGE_VAL)";
+            AsmEmitter n(32);
+            n.put("rt::num(").number(val.numVal).put(')');
+            return std::string(n.view());
+        }
+        case Value::STRING: {
+            std::string name = "k" + std::to_string(c.strings++);
+            c.constants.put("static const rt::Value ").put(name).put(" = rt::str(")
+                .cString(val.strVal).put(");\n");
+            return name;
+        }
+        default:
+            return "rt::nil()";
+        }
+    }
+
+    JitType jitType() const override {
+        if (val.type == Value::NUMBER) return JitType::NUMBER;
+        if (val.type == Value::BOOL) return JitType::BOOL;
+        return JitType::NONE;
+    }
+
+    bool compileJit(JitContext& jit) override {
+        if (jitType() == JitType::NONE) return false;
+        jit.code.constant(val.type == Value::BOOL ? (val.boolVal ? 1.0 : 0.0) : val.numVal);
+        return true;
+    }
 };
 
 class Variable : public Expression {
-    std::string name;
+    Symbol name;
 public:
-    Variable(std::string n) : name(n) {}
+    Variable(Symbol n) : name(n) {}
+    Symbol getName() const { return name; }
     Value execute() override {
-        if (globals.find(name) == globals.end()) return Value(); 
-        return globals[name];
+        auto it = ctx().globals.find(name);
+        if (it == ctx().globals.end()) return Value();
+        return it->second;
+    }
+
+    // Valor atual sem cópia (nullptr se a variável não existe)
+    const Value* lookup() const {
+        auto it = ctx().globals.find(name);
+        return it == ctx().globals.end() ? nullptr : &it->second;
+    }
+
+    bool isInvariant(const WriteSet& written) const override {
+        return !written.has(name) && !written.mutatesLists();
+    }
+
+    bool isNumericInvariant(const WriteSet& written) const override {
+        return !written.has(name);
     }
 
-    void generate(std::ostream& out) override {
-        out << "LOAD " << name << "\n";
+    void collectEscapes(std::set<Symbol>& escaped) const override {
+        escaped.insert(name);
+    }
+
+    void generate(AsmEmitter& out) override {
+        out.put("LOAD_SLOT ").put(slotOf(name)).put('\n');
+    }
+
+    std::string expressionC(CGen& c) override { return c.var(name); }
+
+    JitType jitType() const override { return JitType::NUMBER; }  // garantido pela guarda
+
+    bool compileJit(JitContext& jit) override {
+        jit.code.load(jit.slot(name));
+        return true;
     }
 };
 
 class ListAccess : public Expression {
-    std::string name;
+    Symbol name;
     Expression* indexExpr;
 public:
-    ListAccess(std::string n, Expression* idx) : name(n), indexExpr(idx) {}
+    ListAccess(Symbol n, Expression* idx) : name(n), indexExpr(idx) {}
+
+    // O acesso fica no laço (índice inválido imprime erro a cada execução);
+    // o índice pode sair
+    void findHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        indexExpr->findHoistable(written, out);
+    }
     Value execute() override {
         Value idxVal = indexExpr->execute();
+        auto& globals = ctx().globals;
         if (globals.find(name) != globals.end() && globals[name].type == Value::LIST) {
             int idx = (int)idxVal.numVal;
             auto& list = *globals[name].listVal;
             if (idx >= 0 && idx < (int)list.size()) return list[idx];
         }
-        std::cerr << "Erro: Acesso invalido a lista " << name << std::endl;
+        rt::console.flush();
+        std::cerr << "Erro: Acesso invalido a lista " << ctx().nameOf(name) << std::endl;
         return Value();
     }
 
-    void generate(std::ostream& out) override {
-        out << "LOAD " << name << "\n";
+    void generate(AsmEmitter& out) override {
+        out.put("LOAD_SLOT ").put(slotOf(name)).put('\n');
         indexExpr->generate(out);
-        out << "INDEX\n";
+        out.put("INDEX\n");
+    }
+
+    std::string expressionC(CGen& c) override {
+        std::string idx = indexExpr->expressionC(c);
+        std::string t = c.temp();
+        c.out.put("rt::index(").put(c.var(name)).put(", ").put(idx).put(");\n");
+        return t;
     }
 };
 
 // -------------------- Operações, funções e listas --------------------
 
 class BinaryOp : public Expression {
+public:
+    enum Code { ADD, SUB, MUL, DIV, MOD, EQ, NEQ, LT, LTE, GT, GTE, AND, OR, UNKNOWN };
+
+private:
     Expression *left, *right;
     std::string op;
-public:
-    BinaryOp(Expression* l, std::string o, Expression* r) : left(l), op(o), right(r) {}
-    Value execute() override {
-        Value l = left->execute();
-        Value r = right->execute();
+    Code opcode;
+    BinaryOp* leftOp;   // `left`, quando também é um BinaryOp
 
-        if (op == "+") {
-            if (l.type == Value::STRING || r.type == Value::STRING) 
-                return Value(l.toString() + r.toString());
-            return Value(l.numVal + r.numVal);
+    static Code codeOf(const std::string& op) {
+        static const char* const names[] = {"+", "-", "*", "/", "%", "==", "!=", "<", "<=", ">", ">=", "AND", "OR"};
+        for (int c = ADD; c < UNKNOWN; ++c) {
+            if (op == names[c]) return (Code)c;
+        }
+        return UNKNOWN;
+    }
+
+    // math_expr é recursiva à esquerda: "a" + @b + "c" + ... (como os
+    // modelos expandidos geram, com milhares de termos) vira uma espinha de
+    // BinaryOp à esquerda, um nó por termo. Os percursos abaixo descem por
+    // ela num laço em vez de uma chamada por nível: `chain` recebe os nós de
+    // cima para baixo e o retorno é o operando mais à esquerda. Com
+    // `stopAtReg`, para num nó que já está num registrador.
+    template <class Op>
+    static Expression* spine(Op* top, std::vector<Op*>& chain, bool stopAtReg = false) {
+        for (Op* n = top;; n = n->leftOp) {
+            chain.push_back(n);
+            if (!n->leftOp || (stopAtReg && n->leftOp->reg >= 0)) return n->left;
+        }
+    }
+
+    // Só o valor numérico dos operandos interessa (SUB, MUL, CMP_LT...)
+    bool numericOperands() const {
+        return opcode == SUB || opcode == MUL || opcode == MOD || opcode == LT || opcode == LTE || opcode == GT || opcode == GTE;
+    }
+
+    bool operandInvariant(const Expression* e, const WriteSet& written) const {
+        return numericOperands() ? e->isNumericInvariant(written) : e->isInvariant(written);
+    }
+
+    // Quantos nós da espinha, de baixo para cima, são invariantes (se um nó
+    // não é, nenhum acima dele é)
+    template <class Op>
+    static size_t invariantPrefix(const std::vector<Op*>& chain, const Expression* leaf, const WriteSet& written) {
+        size_t count = 0;
+        for (size_t i = chain.size(); i-- > 0; ++count) {
+            const BinaryOp* n = chain[i];
+            // DIV fica de fora: divisão por zero imprime aviso a cada execução
+            if (n->opcode == DIV) break;
+            if (i + 1 == chain.size() && !n->operandInvariant(leaf, written)) break;
+            if (!n->operandInvariant(n->right, written)) break;
         }
-        if (op == "-") return Value(l.numVal - r.numVal);
-        if (op == "*") return Value(l.numVal * r.numVal);
-        if (op == "/") {
+        return count;
+    }
+
+    // Mesma semântica do operador na VM. `l` é consumido: "+" com uma
+    // string à esquerda anexa no lugar, sem recopiar o texto acumulado.
+    Value apply(Value&& l, const Value& r) const {
+        switch (opcode) {
+        case ADD:
+            if (l.type == Value::STRING) {
+                l.strVal += r.toString();
+                l.numVal = 0;
+                l.boolVal = false;
+                return std::move(l);
+            }
+            if (r.type == Value::STRING) return Value(l.toString() + r.toString());
+            return Value(l.numVal + r.numVal);
+        case SUB: return Value(l.numVal - r.numVal);
+        case MUL: return Value(l.numVal * r.numVal);
+        case DIV:
             if (r.numVal == 0) return Value(0.0);
             return Value(l.numVal / r.numVal);
-        }
-        if (op == "%") return Value(std::fmod(l.numVal, r.numVal));
-        
-        if (op == "==") {
-            if (l.type == Value::NUMBER && r.type == Value::NUMBER) 
+        case MOD: return Value(std::fmod(l.numVal, r.numVal));
+        case EQ:
+            if (l.type == Value::NUMBER && r.type == Value::NUMBER)
                 return Value(std::abs(l.numVal - r.numVal) < 0.00001);
             return Value(l.toString() == r.toString());
+        case NEQ: return Value(l.toString() != r.toString());
+        case GT:  return Value(l.numVal > r.numVal);
+        case LT:  return Value(l.numVal < r.numVal);
+        case GTE: return Value(l.numVal >= r.numVal);
+        case LTE: return Value(l.numVal <= r.numVal);
+        case AND: return Value(l.boolVal && r.boolVal);
+        case OR:  return Value(l.boolVal || r.boolVal);
+        default:  return Value();
         }
-        if (op == "!=") return Value(l.toString() != r.toString());
-        if (op == ">") return Value(l.numVal > r.numVal);
-        if (op == "<") return Value(l.numVal < r.numVal);
-        if (op == ">=") return Value(l.numVal >= r.numVal);
-        if (op == "<=") return Value(l.numVal <= r.numVal);
-        if (op == "AND") return Value(l.boolVal && r.boolVal);
-        if (op == "OR") return Value(l.boolVal || r.boolVal);
+    }
 
-        return Value();
+    void emitInstruction(AsmEmitter& out) const {
+        static const char* const instrs[] = {"ADD\n", "SUB\n", "MUL\n", "DIV\n", "MOD\n", "CMP_EQ\n", "CMP_NEQ\n",
+                                             "CMP_LT\n", "CMP_LTE\n", "CMP_GT\n", "CMP_GTE\n", "AND\n", "OR\n"};
+        if (opcode == UNKNOWN) out.put("; operador não suportado: ").put(op).put('\n');
+        else out.put(instrs[opcode]);
+    }
+
+    JitType combineJit(JitType l, JitType r) const {
+        if (opcode == AND || opcode == OR) {
+            return (l == JitType::BOOL && r == JitType::BOOL) ? JitType::BOOL : JitType::NONE;
+        }
+        if (l != JitType::NUMBER || r != JitType::NUMBER || opcode == UNKNOWN) return JitType::NONE;
+        return opcode <= MOD ? JitType::NUMBER : JitType::BOOL;
+    }
+
+    // xmm0 = esquerdo, xmm1 = direito
+    void emitJit(X64Emitter& code) const {
+        switch (opcode) {
+        case ADD: code.addsd(0, 1); break;
+        case SUB: code.subsd(0, 1); break;
+        case MUL: code.mulsd(0, 1); break;
+        case DIV: code.divOrZero(); break;
+        case MOD: code.call(jitFmod); break;
+        case EQ:  code.nearlyEqual(0.00001); break;
+        case NEQ: code.call(jitNotEqual); break;   // compara via toString()
+        case LT:  code.compare(1); break;
+        case LTE: code.compare(2); break;
+        case GT:  code.compare(1, true); break;
+        case GTE: code.compare(2, true); break;
+        case AND: code.andpd(0, 1); break;
+        case OR:  code.orpd(0, 1); break;
+        default:  break;
+        }
+    }
+
+public:
+    BinaryOp(Expression* l, std::string o, Expression* r)
+        : left(l), right(r), op(std::move(o)), opcode(codeOf(op)), leftOp(dynamic_cast<BinaryOp*>(l)) {}
+    const std::string& getOp() const { return op; }
+    Expression* getLeft() const { return left; }
+    Expression* getRight() const { return right; }
+
+    Value execute() override {
+        if (!leftOp) {
+            Value l = left->execute();
+            return apply(std::move(l), right->execute());
+        }
+        // Pilha compartilhada pelas cadeias aninhadas (operandos entre
+        // parênteses): cada uma usa só o trecho acima de `base`
+        static thread_local std::vector<BinaryOp*> chain;
+        size_t base = chain.size();
+        Value acc = spine(this, chain)->execute();
+        for (size_t i = chain.size(); i-- > base; ) {
+            BinaryOp* n = chain[i];
+            Value r = n->right->execute();
+            acc = n->apply(std::move(acc), r);
+        }
+        chain.resize(base);
+        return acc;
+    }
+
+    bool isInvariant(const WriteSet& written) const override {
+        std::vector<const BinaryOp*> chain;
+        const Expression* leaf = spine(this, chain);
+        return invariantPrefix(chain, leaf, written) == chain.size();
+    }
+
+    // Mesma ordem do percurso recursivo: o maior nó invariante da espinha
+    // (ou o que houver no operando mais à esquerda) e depois os operandos
+    // direitos dos nós acima dele
+    void findHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        std::vector<BinaryOp*> chain;
+        Expression* leaf = spine(this, chain);
+        size_t invariant = invariantPrefix(chain, leaf, written);
+        size_t above = chain.size() - invariant;
+        if (invariant > 0) out.push_back(chain[above]);
+        else leaf->findHoistable(written, out);
+        for (size_t i = above; i-- > 0; ) chain[i]->right->findHoistable(written, out);
+    }
+
+    void generate(AsmEmitter& out) override {
+        if (reg >= 0) {
+            emitPushReg(out, reg);
+            return;
+        }
+        std::vector<BinaryOp*> chain;
+        spine(this, chain, true)->generate(out);
+        for (size_t i = chain.size(); i-- > 0; ) {
+            chain[i]->right->generate(out);
+            chain[i]->emitInstruction(out);
+        }
     }
 
-    void generate(std::ostream& out) override {
-        left->generate(out);
-        right->generate(out);
-
-        if (op == "+")        out << "ADD\n";
-        else if (op == "-")   out << "SUB\n";
-        else if (op == "*")   out << "MUL\n";
-        else if (op == "/")   out << "DIV\n";
-        else if (op == "%")   out << "MOD\n";
-        else if (op == "==")  out << "CMP_EQ\n";
-        else if (op == "!=")  out << "CMP_NEQ\n";
-        else if (op == "<")   out << "CMP_LT\n";
-        else if (op == "<=")  out << "CMP_LTE\n";
-        else if (op == ">")   out << "CMP_GT\n";
-        else if (op == ">=")  out << "CMP_GTE\n";
-        else if (op == "AND") out << "AND\n";
-        else if (op == "OR")  out << "OR\n";
-        else out << "; operador não suportado: " << op << "\n";
+    std::string expressionC(CGen& c) override {
+        static const char* const fns[] = {"rt::add", "rt::sub", "rt::mul", "rt::div", "rt::mod", "rt::eq", "rt::neq",
+                                          "rt::lt", "rt::lte", "rt::gt", "rt::gte", "rt::logicalAnd", "rt::logicalOr"};
+        std::vector<BinaryOp*> chain;
+        std::string acc = spine(this, chain)->expressionC(c);
+        for (size_t i = chain.size(); i-- > 0; ) {
+            BinaryOp* n = chain[i];
+            std::string r = n->right->expressionC(c);
+            if (n->opcode == UNKNOWN) {
+                acc = "rt::nil()";
+                continue;
+            }
+            std::string t = c.temp();
+            c.out.put(std::string_view(fns[n->opcode])).put('(').put(acc).put(", ").put(r).put(");\n");
+            acc = std::move(t);
+        }
+        return acc;
+    }
+
+    JitType jitType() const override {
+        std::vector<const BinaryOp*> chain;
+        JitType t = spine(this, chain)->jitType();
+        for (size_t i = chain.size(); i-- > 0; ) t = chain[i]->combineJit(t, chain[i]->right->jitType());
+        return t;
+    }
+
+    // Mesma semântica de execute() para operandos numéricos. Se a raiz tem
+    // tipo, todos os nós da espinha também têm.
+    bool compileJit(JitContext& jit) override {
+        if (jitType() == JitType::NONE) return false;
+        X64Emitter& code = jit.code;
+        std::vector<BinaryOp*> chain;
+        if (!spine(this, chain)->compileJit(jit)) return false;
+        for (size_t i = chain.size(); i-- > 0; ) {
+            code.pushOperand();
+            if (!chain[i]->right->compileJit(jit)) return false;
+            code.popOperand();
+            chain[i]->emitJit(code);
+        }
+        return true;
     }
 };
 
 class LengthFunc : public Expression {
-    Expression* target;
+    Variable* target;
 public:
-    LengthFunc(Expression* t) : target(t) {}
+    LengthFunc(Variable* t) : target(t) {}
     Value execute() override {
-        Value v = target->execute();
-        if (v.type == Value::LIST) return Value((double)v.listVal->size());
-        if (v.type == Value::STRING) return Value((double)v.strVal.size());
+        // Lê o tamanho direto da variável: copiar o Value duplicaria a
+        // string (ou o shared_ptr da lista) só para consultar o tamanho
+        const Value* v = target->lookup();
+        if (!v) return Value(0.0);
+        if (v->type == Value::LIST) return Value((double)v->listVal->size());
+        if (v->type == Value::STRING) return Value((double)v->strVal.size());
         return Value(0.0);
     }
 
-    void generate(std::ostream& out) override {
+    // O tamanho só muda se a variável for reatribuída ou estendida, ou, se a
+    // lista tiver apelidos, por um "<<" em qualquer variável ("@l[i] :=" não
+    // altera tamanho)
+    bool isInvariant(const WriteSet& written) const override {
+        Symbol name = target->getName();
+        if (written.has(name)) return false;
+        return !written.appends || ctx().aliasedLists.count(name) == 0;
+    }
+
+    void findHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        if (isInvariant(written)) out.push_back(this);
+    }
+
+    void generate(AsmEmitter& out) override {
+        if (reg >= 0) {
+            emitPushReg(out, reg);
+            return;
+        }
         target->generate(out);
-        out << "LEN\n";
+        out.put("LEN\n");
+    }
+
+    std::string expressionC(CGen& c) override {
+        std::string v = target->expressionC(c);
+        std::string t = c.temp();
+        c.out.put("rt::len(").put(v).put(");\n");
+        return t;
     }
 };
 
@@ -234,11 +832,33 @@ public:
         return Value(list);
     }
 
-    void generate(std::ostream& out) override {
+    void collectEscapes(std::set<Symbol>& escaped) const override {
+        for (auto e : elements) e->collectEscapes(escaped);
+    }
+
+    // A lista é nova a cada execução; os elementos podem sair do laço
+    void findHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        for (auto e : elements) e->findHoistable(written, out);
+    }
+
+    void generate(AsmEmitter& out) override {
         for (auto e : elements) {
             e->generate(out);
         }
-        out << "BUILD_LIST " << elements.size() << "\n";
+        out.put("BUILD_LIST ").put(elements.size()).put('\n');
+    }
+
+    std::string expressionC(CGen& c) override {
+        std::vector<std::string> items;
+        for (auto e : elements) items.push_back(e->expressionC(c));
+        std::string t = c.temp();
+        c.out.put("rt::list({");
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (i > 0) c.out.put(", ");
+            c.out.put(items[i]);
+        }
+        c.out.put("});\n");
+        return t;
     }
 };
 
@@ -248,32 +868,86 @@ class Block : public Node {
     std::vector<Node*> statements;
 public:
     void add(Node* s) { statements.push_back(s); }
+    const std::vector<Node*>& getStatements() const { return statements; }
+
     Value execute() override {
         for (auto s : statements) s->execute();
         return Value();
     }
 
-    void generate(std::ostream& out) override {
+    void collectWrites(WriteSet& written) override {
+        for (auto s : statements) s->collectWrites(written);
+    }
+
+    void collectAliases(std::set<Symbol>& aliased) override {
+        for (auto s : statements) s->collectAliases(aliased);
+    }
+
+    void collectImports(std::vector<ImportStmt*>& imports) override {
+        for (auto s : statements) s->collectImports(imports);
+    }
+
+    void collectHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        for (auto s : statements) s->collectHoistable(written, out);
+    }
+
+    // Com -g, cada comando é precedido de ".LINE <linhas>": a sua linha,
+    // depois das linhas dos comandos que o contêm. Vale para as instruções
+    // seguintes, até a próxima .LINE.
+    void generate(AsmEmitter& out) override {
+        if (!ctx().options.lineTable) {
+            for (auto s : statements) s->generate(out);
+            return;
+        }
+        std::vector<int>& lines = ctx().lineChain;
         for (auto s : statements) {
+            lines.push_back(s->line);
+            emitLines(out, lines);
             s->generate(out);
+            lines.pop_back();
+        }
+        // O que vem depois de um bloco aninhado (o salto de volta do laço, o
+        // fim do Se) é do comando que o contém
+        if (!lines.empty() && !statements.empty()) emitLines(out, lines);
+    }
+
+    static void emitLines(AsmEmitter& out, const std::vector<int>& lines) {
+        out.put(".LINE");
+        for (int l : lines) out.put(' ').put(l);
+        out.put('\n');
+    }
+
+    void generateC(CGen& c) override {
+        for (auto s : statements) s->generateC(c);
+    }
+
+    bool compileJit(JitContext& jit) override {
+        for (auto s : statements) {
+            if (!s->compileJit(jit)) return false;
         }
+        return true;
     }
 };
 
 class Assignment : public Node {
-    std::string varName;
+    Symbol varName;
     Expression* indexExpr; 
     Expression* valueExpr;
     bool isAppend;
 public:
-    Assignment(std::string name, Expression* val, bool append = false) 
+    Assignment(Symbol name, Expression* val, bool append = false) 
         : varName(name), indexExpr(nullptr), valueExpr(val), isAppend(append) {}
     
-    Assignment(std::string name, Expression* idx, Expression* val)
+    Assignment(Symbol name, Expression* idx, Expression* val)
         : varName(name), indexExpr(idx), valueExpr(val), isAppend(false) {}
 
+    Symbol getVarName() const { return varName; }
+    Expression* getValue() const { return valueExpr; }
+    bool isPlainStore() const { return !isAppend && !indexExpr; }
+
     Value execute() override {
         Value res = valueExpr->execute();
+        auto& globals = ctx().globals;
         
         if (isAppend) {
             if (globals.find(varName) == globals.end()) globals[varName] = Value(ValueList{});
@@ -291,33 +965,91 @@ public:
         return res;
     }
 
-    void generate(std::ostream& out) override {
+    void collectWrites(WriteSet& written) override {
+        if (indexExpr) {
+            written.indexed.insert(varName);
+        } else {
+            written.vars.insert(varName);
+            if (isAppend) written.appends = true;
+        }
+    }
+
+    void collectAliases(std::set<Symbol>& aliased) override {
+        // Uma lista existente guardada aqui passa a ter mais um nome (ou a
+        // viver dentro de outra lista)
+        valueExpr->collectEscapes(aliased);
+        if (isPlainStore()
+            && (dynamic_cast<Variable*>(valueExpr) || dynamic_cast<ListAccess*>(valueExpr))) {
+            aliased.insert(varName);
+        }
+    }
+
+    void collectHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        if (indexExpr) indexExpr->findHoistable(written, out);
+        valueExpr->findHoistable(written, out);
+    }
+
+    void generate(AsmEmitter& out) override {
         if (indexExpr) {
             indexExpr->generate(out);   // índice
             valueExpr->generate(out);   // valor
-            out << "STORE_INDEX " << varName << "\n";
+            out.put("STORE_INDEX_SLOT ").put(slotOf(varName)).put('\n');
         } else if (isAppend) {
             valueExpr->generate(out);
-            out << "APPEND " << varName << "\n";
+            out.put("APPEND_SLOT ").put(slotOf(varName)).put('\n');
         } else {
             valueExpr->generate(out);
-            out << "STORE " << varName << "\n";
+            out.put("STORE_SLOT ").put(slotOf(varName)).put('\n');
         }
     }
+
+    void generateC(CGen& c) override {
+        if (indexExpr) {
+            std::string idx = indexExpr->expressionC(c);
+            std::string val = valueExpr->expressionC(c);
+            c.line().put("rt::storeIndex(").put(c.var(varName)).put(", ").put(idx).put(", ")
+                .put(c.take(val)).put(", ").cString(ctx().nameOf(varName)).put(");\n");
+        } else if (isAppend) {
+            std::string val = valueExpr->expressionC(c);
+            c.line().put("rt::append(").put(c.var(varName)).put(", ").put(c.take(val)).put(");\n");
+        } else {
+            std::string val = valueExpr->expressionC(c);
+            c.line().put(c.var(varName)).put(" = ").put(c.take(val)).put(";\n");
+        }
+    }
+
+    // Só atribuições numéricas: assim o tipo das variáveis não muda no laço
+    bool compileJit(JitContext& jit) override {
+        if (!isPlainStore() || valueExpr->jitType() != JitType::NUMBER) return false;
+        if (!valueExpr->compileJit(jit)) return false;
+        jit.code.store(jit.slot(varName));
+        return true;
+    }
 };
 
 class Question : public Node {
     Expression* expr;
 public:
     Question(Expression* e) : expr(e) {}
+
+    void collectHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        expr->findHoistable(written, out);
+    }
     Value execute() override {
-        std::cout << "[?] " << expr->execute().toString() << std::endl;
+        std::string line = "[?] " + expr->execute().toString();
+        line += '\n';
+        rt::console.write(line);
         return Value();
     }
 
-    void generate(std::ostream& out) override {
+    void generate(AsmEmitter& out) override {
         expr->generate(out);
-        out << "QUESTION\n";
+        out.put("QUESTION\n");
+    }
+
+    void generateC(CGen& c) override {
+        std::string v = expr->expressionC(c);
+        c.line().put("rt::print(\"[?] \", ").put(v).put(");\n");
     }
 };
 
@@ -326,34 +1058,47 @@ class Output : public Node {
     std::string prefix;
 public:
     Output(std::string p, Expression* e) : prefix(p), expr(e) {}
+
+    void collectHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        expr->findHoistable(written, out);
+    }
     Value execute() override {
-        std::cout << prefix << " " << expr->execute().toString() << std::endl;
+        std::string line = prefix + " " + expr->execute().toString();
+        line += '\n';
+        rt::console.write(line);
         return Value();
     }
 
-    void generate(std::ostream& out) override {
+    void generate(AsmEmitter& out) override {
         expr->generate(out);
         if (prefix == ">>") {
-            out << "PRINT\n";
+            out.put("PRINT\n");
         } else if (prefix == "!") {
-            out << "PRINT_CONCL\n";
+            out.put("PRINT_CONCL\n");
         } else {
-            out << "PRINT\n";
+            out.put("PRINT\n");
         }
     }
+
+    void generateC(CGen& c) override {
+        std::string v = expr->expressionC(c);
+        c.line().put(prefix == "!" ? "rt::print(\"! \", " : "rt::print(\">> \", ").put(v).put(");\n");
+    }
 };
 
 class InputAnswer : public Node {
-    std::string varName;
+    Symbol varName;
 public:
-    InputAnswer(std::string v) : varName(v) {}
+    InputAnswer(Symbol v) : varName(v) {}
     Value execute() override {
-        std::cout << "> ";
+        auto& globals = ctx().globals;
+        rt::console.write("> ", 2);
         std::string line;
-        
-        std::cin >> std::ws; 
-        
-        if (std::getline(std::cin, line)) {
+
+        // Pula as linhas em branco, como std::cin >> std::ws
+        rt::console.skipSpace();
+
+        if (rt::console.readLine(line)) {
             try {
                 size_t pos;
                 double d = std::stod(line, &pos);
@@ -368,8 +1113,16 @@ public:
         return Value();
     }
 
-    void generate(std::ostream& out) override {
-        out << "INPUT " << varName << "\n";
+    void collectWrites(WriteSet& written) override {
+        written.vars.insert(varName);
+    }
+
+    void generate(AsmEmitter& out) override {
+        out.put("INPUT_SLOT ").put(slotOf(varName)).put('\n');
+    }
+
+    void generateC(CGen& c) override {
+        c.line().put("rt::input(").put(c.var(varName)).put(");\n");
     }
 };
 
@@ -377,8 +1130,10 @@ class IfStmt : public Node {
     Expression* cond;
     Block* thenBlock;
     Block* elseBlock;
+    int site;
 public:
-    IfStmt(Expression* c, Block* t, Block* e = nullptr) : cond(c), thenBlock(t), elseBlock(e) {}
+    IfStmt(Expression* c, Block* t, Block* e = nullptr)
+        : cond(c), thenBlock(t), elseBlock(e), site(nextSiteId()) {}
     Value execute() override {
         Value c = cond->execute();
         bool isTrue = (c.type == Value::BOOL && c.boolVal) 
@@ -390,54 +1145,341 @@ public:
         return Value();
     }
 
-    void generate(std::ostream& out) override {
+    void collectWrites(WriteSet& written) override {
+        thenBlock->collectWrites(written);
+        if (elseBlock) elseBlock->collectWrites(written);
+    }
+
+    void collectAliases(std::set<Symbol>& aliased) override {
+        thenBlock->collectAliases(aliased);
+        if (elseBlock) elseBlock->collectAliases(aliased);
+    }
+
+    void collectImports(std::vector<ImportStmt*>& imports) override {
+        thenBlock->collectImports(imports);
+        if (elseBlock) elseBlock->collectImports(imports);
+    }
+
+    void collectHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        cond->findHoistable(written, out);
+        thenBlock->collectHoistable(written, out);
+        if (elseBlock) elseBlock->collectHoistable(written, out);
+    }
+
+    void generate(AsmEmitter& out) override {
         int id = nextLabelId();
-        std::string elseLabel = "L_else_" + std::to_string(id);
-        std::string endLabel  = "L_end_if_" + std::to_string(id);
+        std::string key = "if" + std::to_string(site);
 
         cond->generate(out);
+        out.put(".SITE ").put(key).put('\n');
+
+        const SiteProfile* p = profileOf(key);
+        if (elseBlock && p && p->whenTrue + p->whenFalse > 0) {
+            // Com perfil: o braço mais executado segue direto, sem o JUMP
+            // para o fim; o outro vai para o código frio e volta por salto.
+            bool thenHot = p->whenTrue >= p->whenFalse;
+            out.put(thenHot ? "JUMP_IF_FALSE " : "JUMP_IF_TRUE ").label("L_cold_", id).put('\n');
+            (thenHot ? thenBlock : elseBlock)->generate(out);
+            out.put("LABEL ").label("L_end_if_", id).put('\n');
+
+            AsmEmitter cold(256);
+            (thenHot ? elseBlock : thenBlock)->generate(cold);
+            ctx().coldCode.put("LABEL ").label("L_cold_", id).put('\n');
+            ctx().coldCode.append(cold);
+            ctx().coldCode.put("JUMP ").label("L_end_if_", id).put('\n');
+            return;
+        }
+
         if (elseBlock) {
-            out << "JUMP_IF_FALSE " << elseLabel << "\n";
+            out.put("JUMP_IF_FALSE ").label("L_else_", id).put('\n');
             thenBlock->generate(out);
-            out << "JUMP " << endLabel << "\n";
-            out << "LABEL " << elseLabel << "\n";
+            out.put("JUMP ").label("L_end_if_", id).put('\n');
+            out.put("LABEL ").label("L_else_", id).put('\n');
             elseBlock->generate(out);
-            out << "LABEL " << endLabel << "\n";
+            out.put("LABEL ").label("L_end_if_", id).put('\n');
         } else {
-            out << "JUMP_IF_FALSE " << endLabel << "\n";
+            out.put("JUMP_IF_FALSE ").label("L_end_if_", id).put('\n');
             thenBlock->generate(out);
-            out << "LABEL " << endLabel << "\n";
+            out.put("LABEL ").label("L_end_if_", id).put('\n');
+        }
+    }
+
+    void generateC(CGen& c) override {
+        std::string v = cond->expressionC(c);
+        c.line().put("if (rt::truthy(").put(v).put(")) {\n");
+        c.depth++;
+        thenBlock->generateC(c);
+        c.depth--;
+        if (elseBlock) {
+            c.line().put("} else {\n");
+            c.depth++;
+            elseBlock->generateC(c);
+            c.depth--;
         }
+        c.line().put("}\n");
+    }
+
+    bool compileJit(JitContext& jit) override {
+        if (cond->jitType() == JitType::NONE || !cond->compileJit(jit)) return false;
+        X64Emitter& code = jit.code;
+        int elseLabel = code.newLabel(), endLabel = code.newLabel();
+        code.jumpIfFalse(elseLabel);
+        if (!thenBlock->compileJit(jit)) return false;
+        code.jump(endLabel);
+        code.bind(elseLabel);
+        if (elseBlock && !elseBlock->compileJit(jit)) return false;
+        code.bind(endLabel);
+        return true;
+    }
+};
+
+// Importar "modulo.ms": executa o módulo nesse ponto, com as mesmas variáveis
+// do programa (cada Importar executa o módulo de novo). No assembly o módulo
+// é compilado à parte e o ligador (linker.h) troca o ".IMPORT" pelo código
+// dele; no --run e no --emit=c a AST do módulo é analisada no mesmo contexto
+// do programa (parseImports) e fica em `module`.
+class ImportStmt : public Node {
+    std::string path;   // como escrito no fonte, relativo a quem importa
+public:
+    Block* module = nullptr;
+
+    explicit ImportStmt(std::string p) : path(std::move(p)) {}
+    const std::string& getPath() const { return path; }
+
+    Value execute() override {
+        if (module) module->execute();
+        return Value();
+    }
+
+    void collectWrites(WriteSet& written) override {
+        written.unknown = true;
+    }
+
+    void collectImports(std::vector<ImportStmt*>& imports) override {
+        imports.push_back(this);
+    }
+
+    void generate(AsmEmitter& out) override {
+        out.put(".IMPORT ").put(path).put('\n');
+    }
+
+    void generateC(CGen& c) override {
+        if (module) module->generateC(c);
     }
 };
 
 class WhileStmt : public Node {
     Expression* cond;
     Block* block;
+    int site;
+
+    // JIT: voltas contadas até compilar, código gerado e suas guardas
+    long backEdges = 0;
+    bool jitUnsupported = false;
+    std::unique_ptr<JitCode> jitted;
+    std::vector<Value*> jitGuards;
+
 public:
-    WhileStmt(Expression* c, Block* b) : cond(c), block(b) {}
+    WhileStmt(Expression* c, Block* b) : cond(c), block(b), site(nextSiteId()) {}
     Value execute() override {
         while (true) {
+            if (ctx().jit.enabled && !jitUnsupported && backEdges >= ctx().jit.threshold
+                && runJit()) {
+                break;
+            }
             Value c = cond->execute();
             bool isTrue = (c.type == Value::BOOL && c.boolVal) 
                        || (c.type == Value::NUMBER && c.numVal != 0);
             if (!isTrue) break;
             block->execute();
+            ++backEdges;
         }
         return Value();
     }
 
-    void generate(std::ostream& out) override {
+    // Executa o restante do laço em código nativo, compilando-o na primeira
+    // vez. Devolve false (e o interpretador continua) se o laço não pode ser
+    // compilado ou se alguma variável deixou de ser número.
+    bool runJit() {
+        if (!jitted) {
+            X64Emitter code;
+            JitContext jit(code);
+            code.prologue();
+            bool ok = compileJit(jit);
+            code.epilogue();
+            if (!ok || !code.finish()) {
+                jitUnsupported = true;
+                return false;
+            }
+            if (jit.pending) {
+                backEdges = 0;   // espera mais `threshold` voltas
+                return false;
+            }
+            auto loaded = std::make_unique<JitCode>();
+            if (!loaded->load(code.bytesOut())) {
+                jitUnsupported = true;
+                return false;
+            }
+            jitted = std::move(loaded);
+            jitGuards = std::move(jit.guards);
+        }
+        for (Value* v : jitGuards) {
+            if (v->type != Value::NUMBER) return false;
+        }
+        jitted->run();
+        return true;
+    }
+
+    bool compileJit(JitContext& jit) override {
+        if (cond->jitType() == JitType::NONE) return false;
+        X64Emitter& code = jit.code;
+        int head = code.newLabel(), end = code.newLabel();
+        code.bind(head);
+        if (!cond->compileJit(jit)) return false;
+        code.jumpIfFalse(end);
+        if (!block->compileJit(jit)) return false;
+        code.jump(head);
+        code.bind(end);
+        return true;
+    }
+
+    void collectWrites(WriteSet& written) override {
+        block->collectWrites(written);
+    }
+
+    void collectAliases(std::set<Symbol>& aliased) override {
+        block->collectAliases(aliased);
+    }
+
+    void collectImports(std::vector<ImportStmt*>& imports) override {
+        block->collectImports(imports);
+    }
+
+    // Laço aninhado: o que o laço de fora não altera também não muda aqui
+    void collectHoistable(const WriteSet& written, std::vector<Expression*>& out) override {
+        cond->findHoistable(written, out);
+        block->collectHoistable(written, out);
+    }
+
+    // Laço contado: "Enquanto @v < limite" (ou <=) cujo corpo termina com
+    // "@v := @v + passo", com passo inteiro positivo, e não altera @v nem o
+    // limite em nenhum outro ponto (idem > / >= com "@v := @v - passo").
+    // Devolve o passo com sinal, ou 0 se o laço não tem essa forma.
+    double countedStep(const WriteSet& written) const {
+        auto test = dynamic_cast<BinaryOp*>(cond);
+        if (!test) return 0;
+        const std::string& cmp = test->getOp();
+        bool up = (cmp == "<" || cmp == "<=");
+        bool down = (cmp == ">" || cmp == ">=");
+        auto var = dynamic_cast<Variable*>(test->getLeft());
+        if (!(up || down) || !var || !test->getRight()->isInvariant(written)) return 0;
+
+        const auto& stmts = block->getStatements();
+        if (stmts.empty()) return 0;
+        auto inc = dynamic_cast<Assignment*>(stmts.back());
+        if (!inc || !inc->isPlainStore() || inc->getVarName() != var->getName()) return 0;
+        auto next = dynamic_cast<BinaryOp*>(inc->getValue());
+        if (!next || next->getOp() != (up ? "+" : "-")) return 0;
+        auto self = dynamic_cast<Variable*>(next->getLeft());
+        auto step = dynamic_cast<Literal*>(next->getRight());
+        if (!self || self->getName() != var->getName() || !step) return 0;
+        const Value& c = step->value();
+        if (c.type != Value::NUMBER || c.numVal <= 0 || c.numVal != std::floor(c.numVal)) return 0;
+
+        WriteSet others;
+        for (size_t i = 0; i + 1 < stmts.size(); ++i) stmts[i]->collectWrites(others);
+        if (others.has(var->getName())) return 0;
+        return up ? c.numVal : -c.numVal;
+    }
+
+    void generate(AsmEmitter& out) override {
         int id = nextLabelId();
-        std::string startLabel = "L_while_" + std::to_string(id);
-        std::string endLabel   = "L_end_while_" + std::to_string(id);
 
-        out << "LABEL " << startLabel << "\n";
+        // Subexpressões da condição e dos comandos do corpo que o corpo não
+        // altera são calculadas uma vez, antes do laço, e ficam em
+        // registradores durante o laço. As que já estão num registrador
+        // (içadas por um laço de fora) ficam nele. Um Importar no corpo traz
+        // código que usa os mesmos registradores: nada é içado.
+        WriteSet written;
+        block->collectWrites(written);
+        std::vector<Expression*> invariants;
+        if (!written.unknown) {
+            cond->findHoistable(written, invariants);
+            block->collectHoistable(written, invariants);
+        }
+        invariants.erase(std::remove_if(invariants.begin(), invariants.end(), [](Expression* e) { return e->reg >= 0; }),
+                         invariants.end());
+
+        for (auto e : invariants) {
+            int r = ctx().registers.acquire();
+            e->generate(out);
+            emitPopToReg(out, r);
+            e->reg = r;
+        }
+
+        // ".SITE whileN.body" conta as voltas, em qualquer cópia do corpo
+        std::string key = "while" + std::to_string(site);
+        auto generateBody = [&](AsmEmitter& to) {
+            to.put(".SITE ").put(key).put(".body\n");
+            block->generate(to);
+        };
+        AsmEmitter body(256);
+        generateBody(body);
+
+        double step = countedStep(written);
+        int factor = ctx().options.unrollFactor;
+
+        // Com perfil, só desenrola laços que rodaram com média de voltas por
+        // entrada de pelo menos `factor` (senão o teste extra não se paga)
+        const SiteProfile* test = profileOf(key);
+        const SiteProfile* trips = profileOf(key + ".body");
+        if (test && trips && trips->count < test->whenFalse * factor) factor = 1;
+        if (test && test->whenFalse == 0) factor = 1;
+
+        if (step != 0 && factor > 1
+            && (body.lineCount() - 1) * factor <= (size_t)ctx().options.unrollMaxInstrs) {
+            // Laço desenrolado: um único teste verifica se as próximas
+            // `factor` iterações cabem no limite (@v + (factor-1)*passo) e o
+            // corpo é repetido `factor` vezes. O laço original, logo abaixo,
+            // executa as iterações restantes.
+            auto test = static_cast<BinaryOp*>(cond);
+            Literal offset(Value(std::fabs(step) * (factor - 1)));
+            BinaryOp ahead(test->getLeft(), step > 0 ? "+" : "-", &offset);
+            BinaryOp check(&ahead, test->getOp(), test->getRight());
+
+            out.put("LABEL ").label("L_unroll_", id).put('\n');
+            check.generate(out);
+            out.put("JUMP_IF_FALSE ").label("L_while_", id).put('\n');
+            out.append(body);
+            for (int k = 1; k < factor; ++k) generateBody(out);
+            out.put("JUMP ").label("L_unroll_", id).put('\n');
+
+            body = AsmEmitter(256);
+            generateBody(body);
+        }
+
+        out.put("LABEL ").label("L_while_", id).put('\n');
         cond->generate(out);
-        out << "JUMP_IF_FALSE " << endLabel << "\n";
-        block->generate(out);
-        out << "JUMP " << startLabel << "\n";
-        out << "LABEL " << endLabel << "\n";
+        out.put(".SITE ").put(key).put('\n');
+        out.put("JUMP_IF_FALSE ").label("L_end_while_", id).put('\n');
+        out.append(body);
+        out.put("JUMP ").label("L_while_", id).put('\n');
+        out.put("LABEL ").label("L_end_while_", id).put('\n');
+
+        for (auto e : invariants) {
+            ctx().registers.release(e->reg);
+            e->reg = -1;
+        }
+    }
+
+    void generateC(CGen& c) override {
+        c.line().put("while (true) {\n");
+        c.depth++;
+        std::string v = cond->expressionC(c);
+        c.line().put("if (!rt::truthy(").put(v).put(")) break;\n");
+        block->generateC(c);
+        c.depth--;
+        c.line().put("}\n");
     }
 };
 
@@ -0,0 +1,132 @@
+#ifndef EMITTER_H
+#define EMITTER_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Emissor de assembly: os generate() escrevem num único buffer de bytes
+// crescente (sem iostream nem strings temporárias) e o arquivo inteiro é
+// gravado com uma só escrita no final.
+class AsmEmitter {
+    std::vector<char> buf;
+    size_t used = 0;
+
+    char* reserve(size_t n) {
+        if (used + n > buf.size()) {
+            size_t cap = buf.size() * 2;
+            if (cap < used + n) cap = used + n;
+            buf.resize(cap);
+        }
+        return buf.data() + used;
+    }
+
+public:
+    explicit AsmEmitter(size_t initialCapacity = 1 << 16) : buf(initialCapacity) {}
+
+    size_t size() const { return used; }
+    // Linhas, sem as .LINE da tabela de linhas (-g): o -g não muda o código
+    size_t lineCount() const {
+        size_t lines = 0;
+        for (const char *p = buf.data(), *end = p + used; p < end; ) {
+            const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            if (!nl) break;
+            if (nl - p < 6 || std::memcmp(p, ".LINE ", 6) != 0) ++lines;
+            p = nl + 1;
+        }
+        return lines;
+    }
+    std::string_view view() const { return std::string_view(buf.data(), used); }
+
+    void write(const char* s, size_t n) {
+        std::memcpy(reserve(n), s, n);
+        used += n;
+    }
+
+    // Literais (opcodes já formatados, ex.: "ADD\n"): tamanho em tempo de compilação
+    template <size_t N>
+    AsmEmitter& put(const char (&s)[N]) { write(s, N - 1); return *this; }
+
+    AsmEmitter& put(std::string_view s) { write(s.data(), s.size()); return *this; }
+
+    AsmEmitter& put(char c) {
+        *reserve(1) = c;
+        used += 1;
+        return *this;
+    }
+
+    AsmEmitter& put(long long n) {
+        char* p = reserve(24);
+        used = std::to_chars(p, p + 24, n).ptr - buf.data();
+        return *this;
+    }
+    AsmEmitter& put(int n) { return put((long long)n); }
+    AsmEmitter& put(size_t n) { return put((long long)n); }
+
+    // Mesmo formato de "%.15g" (antigo std::setprecision(15))
+    AsmEmitter& number(double d) {
+        char* p = reserve(32);
+        used = std::to_chars(p, p + 32, d, std::chars_format::general, 15).ptr - buf.data();
+        return *this;
+    }
+
+    // Nome de label: prefixo + id (ex.: L_while_3)
+    template <size_t N>
+    AsmEmitter& label(const char (&prefix)[N], int id) { return put(prefix).put(id); }
+
+    // String entre aspas, escapando '"' e '\'
+    AsmEmitter& quoted(std::string_view s) {
+        char* p = reserve(s.size() * 2 + 2);
+        char* start = p;
+        *p++ = '"';
+        for (char c : s) {
+            if (c == '"' || c == '\\') *p++ = '\\';
+            *p++ = c;
+        }
+        *p++ = '"';
+        used += p - start;
+        return *this;
+    }
+
+    // Literal de string C/C++ (--emit=c); bytes não ASCII vão sem escape
+    AsmEmitter& cString(std::string_view s) {
+        char* p = reserve(s.size() * 4 + 2);
+        char* start = p;
+        *p++ = '"';
+        for (char c : s) {
+            unsigned char u = (unsigned char)c;
+            if (c == '"' || c == '\\') {
+                *p++ = '\\';
+                *p++ = c;
+            } else if (c == '\n') {
+                *p++ = '\\';
+                *p++ = 'n';
+            } else if (u < 0x20 || u == 0x7F) {
+                *p++ = '\\';
+                *p++ = (char)('0' + (u >> 6));
+                *p++ = (char)('0' + ((u >> 3) & 7));
+                *p++ = (char)('0' + (u & 7));
+            } else {
+                *p++ = c;
+            }
+        }
+        *p++ = '"';
+        used += p - start;
+        return *this;
+    }
+
+    void append(const AsmEmitter& other) { write(other.buf.data(), other.used); }
+
+    bool writeTo(const std::string& path) const {
+        FILE* f = std::fopen(path.c_str(), "wb");
+        if (!f) return false;
+        bool ok = std::fwrite(buf.data(), 1, used, f) == used;
+        return std::fclose(f) == 0 && ok;
+    }
+};
+
+#endif
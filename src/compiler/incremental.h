@@ -0,0 +1,338 @@
+#ifndef INCREMENTAL_H
+#define INCREMENTAL_H
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ast.h"
+
+// Definido em parser.y
+bool parseBuffer(CompileContext& context, char* data, size_t size, int firstLine);
+
+// Parse incremental, para o plugin do editor: a cada tecla, só o trecho do
+// fonte atingido pela edição é lido de novo pelo lexer e pelo parser; o resto
+// da AST é reaproveitado.
+//
+// O fonte é dividido em trechos no nível 0 de indentação. Uma linha encostada
+// na margem depois de outra também encostada fecha todos os blocos (o lexer
+// já emitiu os TOKEN_DEDENT), então o que vem depois não depende do que veio
+// antes: cada trecho é um comando do nível 0 com os seus blocos, seguido das
+// linhas em branco e de comentário. Um "-> Senao" logo depois de um bloco
+// continua o mesmo trecho. Cada trecho é analisado sozinho, como um programa,
+// e a sequência de tokens que o lexer produz para ele é a mesma que produziria
+// no fonte inteiro. Strings literais podem ocupar várias linhas: não há
+// fronteira dentro delas, e abrir aspas sem fechá-las junta o resto do fonte
+// num trecho só até que sejam fechadas.
+//
+// Mensagens de erro: como o yyparse, só a do primeiro trecho com erro, com a
+// mesma linha. O "esperando ..." da mensagem pode listar tokens diferentes,
+// porque o parser do trecho começa no estado inicial.
+
+// Posição no texto, a partir de 0; a coluna é em bytes
+struct TextPosition {
+    size_t line = 0;
+    size_t column = 0;
+};
+
+// O que uma edição custou
+struct EditStats {
+    size_t reparsedChunks = 0;
+    size_t reparsedLines = 0;
+    size_t reusedChunks = 0;
+};
+
+class IncrementalDocument {
+    struct Chunk {
+        size_t firstLine = 0;
+        size_t lineCount = 0;
+        Block* block = nullptr;                  // nullptr: erro de sintaxe
+        std::vector<std::unique_ptr<Node>> nodes; // nós criados pelo parse do trecho
+        std::string diagnostics;
+        size_t parsedAt = 0;                     // firstLine no parse (linha das mensagens)
+        size_t nodesAt = 0;                      // firstLine que as linhas dos nós refletem
+    };
+
+    CompileContext context;                      // símbolos internados, sites
+    std::vector<std::string> lines{std::string()};
+    std::vector<bool> inString{false};           // a linha começa dentro de "..."
+    std::vector<Chunk> chunks;
+    std::vector<char> scratch;                   // buffer do yy_scan_buffer
+    std::unique_ptr<Block> root;
+    bool rootDirty = true;
+
+    static std::string_view trimmed(const std::string& line) {
+        size_t i = line.find_first_not_of(" \t");
+        return i == std::string::npos ? std::string_view() : std::string_view(line).substr(i);
+    }
+
+    static bool atMargin(const std::string& line) {
+        return line.empty() || (line[0] != ' ' && line[0] != '\t');
+    }
+
+    // Primeiro token de um comando: @var, ?, >, >>, !, ->, Enquanto
+    static bool startsStatement(std::string_view line) {
+        if (line.empty()) return false;
+        char c = line[0];
+        if (c == '@') return line.size() > 1 && (std::isalnum((unsigned char)line[1]) || line[1] == '_');
+        return c == '?' || c == '>' || c == '!' ||
+               line.substr(0, 2) == "->" || line.substr(0, 8) == "Enquanto" ||
+               line.substr(0, 8) == "Importar";
+    }
+
+    // Estado de string no fim da linha, como o lexer: '#' fora de string
+    // comenta o resto da linha. As últimas aspas do fonte, sem par, o lexer
+    // ignora; aqui elas contam como abertas, o que só junta trechos.
+    static bool stringOpenAfter(const std::string& line, bool open) {
+        for (char c : line) {
+            if (c == '"') open = !open;
+            else if (c == '#' && !open) break;
+        }
+        return open;
+    }
+
+    // Troca v[pos, pos + count) por `items`, deslocando o resto de v uma vez
+    // só (nada, no caso comum de digitar numa linha)
+    template <typename T>
+    static void splice(std::vector<T>& v, size_t pos, size_t count, std::vector<T>& items) {
+        if (items.size() > count) {
+            size_t grow = items.size() - count;
+            v.resize(v.size() + grow);
+            std::move_backward(v.begin() + pos + count, v.end() - grow, v.end());
+        } else {
+            v.erase(v.begin() + pos + items.size(), v.begin() + pos + count);
+        }
+        std::move(items.begin(), items.end(), v.begin() + pos);
+    }
+
+    static void split(std::string_view text, std::vector<std::string>& out) {
+        size_t start = 0;
+        for (size_t nl; (nl = text.find('\n', start)) != std::string_view::npos; start = nl + 1) {
+            out.emplace_back(text.substr(start, nl - start));
+        }
+        out.emplace_back(text.substr(start));
+    }
+
+    // Fim (exclusivo) do trecho que começa em `start`: a próxima linha que
+    // começa um comando na margem depois de outra linha na margem (linhas que
+    // começam dentro de uma string não contam: o lexer não vê a quebra de
+    // linha antes delas). Antes do primeiro comando do fonte só há linhas em
+    // branco e comentários, que ficam no primeiro trecho.
+    size_t chunkEnd(size_t start) const {
+        bool statement = false;
+        bool margin = false;
+        for (size_t l = start; l < lines.size(); ++l) {
+            if (inString[l]) continue;
+            if (statement && margin && startsStatement(lines[l])) return l;
+            margin = atMargin(lines[l]);
+            if (startsStatement(trimmed(lines[l]))) statement = true;
+        }
+        return lines.size();
+    }
+
+    // Há fronteira de trecho antes da linha l, sabendo que há comandos antes dela?
+    bool boundaryBefore(size_t l) const {
+        if (inString[l] || !startsStatement(lines[l])) return false;
+        size_t k = l - 1;
+        while (inString[k]) --k;
+        return atMargin(lines[k]);
+    }
+
+    void parse(Chunk& chunk) {
+        scratch.clear();
+        size_t end = chunk.firstLine + chunk.lineCount;
+        for (size_t l = chunk.firstLine; l < end; ++l) {
+            scratch.insert(scratch.end(), lines[l].begin(), lines[l].end());
+            if (l + 1 < lines.size()) scratch.push_back('\n');
+        }
+        scratch.push_back(0);
+        scratch.push_back(0);
+
+        chunk.nodes.clear();
+        context.diagnostics.clear();
+        context.ownedNodes = &chunk.nodes;
+        bool parsed = parseBuffer(context, scratch.data(), scratch.size(), (int)chunk.firstLine + 1);
+        context.ownedNodes = nullptr;
+
+        chunk.block = parsed ? context.root : nullptr;
+        chunk.diagnostics.swap(context.diagnostics);
+        context.diagnostics.clear();
+        chunk.parsedAt = chunk.firstLine;
+        chunk.nodesAt = chunk.firstLine;
+        context.root = nullptr;
+    }
+
+    // Recalcula inString depois que as linhas [first, first + removed) viraram
+    // `added` linhas, até o estado voltar a ser o de antes. Devolve a primeira
+    // linha a partir da qual nada mudou.
+    size_t updateStrings(size_t first, size_t removed, size_t added) {
+        long delta = (long)added - (long)removed;
+        std::vector<bool> fresh;
+        bool open = inString[first];
+        size_t next = first + 1;
+        for (; next < lines.size(); ++next) {
+            open = stringOpenAfter(lines[next - 1], open);
+            if (next >= first + added && inString[next - delta] == open) break;
+            fresh.push_back(open);
+        }
+        size_t oldEnd = next < lines.size() ? (size_t)((long)next - delta) : inString.size();
+        splice(inString, first + 1, oldEnd - first - 1, fresh);
+        return next;
+    }
+
+    // Divide em trechos e analisa as linhas [start, lines.size()), parando na
+    // primeira fronteira em `stopFrom` ou depois dela que `stop` aceite
+    template <typename Stop>
+    std::vector<Chunk> rechunk(size_t start, size_t stopFrom, Stop stop) {
+        std::vector<Chunk> fresh;
+        for (size_t line = start; line < lines.size(); ) {
+            Chunk chunk;
+            chunk.firstLine = line;
+            line = chunkEnd(line);
+            chunk.lineCount = line - chunk.firstLine;
+            parse(chunk);
+            fresh.push_back(std::move(chunk));
+            if (line >= stopFrom && line < lines.size() && stop(line)) break;
+        }
+        return fresh;
+    }
+
+public:
+    IncrementalDocument() = default;
+    IncrementalDocument(const IncrementalDocument&) = delete;
+    IncrementalDocument& operator=(const IncrementalDocument&) = delete;
+
+    explicit IncrementalDocument(std::string_view text) { setText(text); }
+
+    // Troca o texto inteiro (abrir o arquivo): análise completa
+    void setText(std::string_view text) {
+        lines.clear();
+        split(text, lines);
+        inString.assign(lines.size(), false);
+        for (size_t l = 1; l < lines.size(); ++l) inString[l] = stringOpenAfter(lines[l - 1], inString[l - 1]);
+        chunks = rechunk(0, lines.size(), [](size_t) { return false; });
+        rootDirty = true;
+    }
+
+    // Substitui o texto entre `from` e `to` (como uma edição do editor) e
+    // reanalisa só os trechos atingidos
+    EditStats edit(TextPosition from, TextPosition to, std::string_view text) {
+        from.line = std::min(from.line, lines.size() - 1);
+        to.line = std::min(to.line, lines.size() - 1);
+        if (to.line < from.line || (to.line == from.line && to.column < from.column)) std::swap(from, to);
+        from.column = std::min(from.column, lines[from.line].size());
+        to.column = std::min(to.column, lines[to.line].size());
+
+        std::string joined = lines[from.line].substr(0, from.column);
+        joined.append(text);
+        joined.append(lines[to.line], to.column, std::string::npos);
+        std::vector<std::string> inserted;
+        split(joined, inserted);
+
+        size_t first = from.line;
+        size_t removed = to.line - from.line + 1;
+        size_t added = inserted.size();
+        long delta = (long)added - (long)removed;
+
+        splice(lines, first, removed, inserted);
+
+        size_t settled = std::max(first + added, updateStrings(first, removed, added));
+
+        // Se a edição começa no início de um trecho que deixou de ser início,
+        // as linhas novas se juntam ao trecho anterior
+        size_t ci = std::upper_bound(chunks.begin(), chunks.end(), first,
+                                     [](size_t l, const Chunk& c) { return l < c.firstLine; }) - chunks.begin() - 1;
+        if (ci > 0 && chunks[ci].firstLine == first && !boundaryBefore(first)) --ci;
+
+        // Depois das linhas inseridas (e das que mudaram de estado de string),
+        // a primeira fronteira que já existia antes, deslocada, encerra a
+        // reanálise: dali em diante nada mudou
+        size_t cj = chunks.size();
+        std::vector<Chunk> fresh = rechunk(chunks[ci].firstLine, settled + 1, [&](size_t line) {
+            if (inString[line - 1]) return false;
+            size_t old = (size_t)((long)line - delta);
+            auto it = std::lower_bound(chunks.begin() + ci + 1, chunks.end(), old,
+                                       [](const Chunk& c, size_t l) { return c.firstLine < l; });
+            if (it == chunks.end() || it->firstLine != old) return false;
+            cj = it - chunks.begin();
+            return true;
+        });
+
+        EditStats stats;
+        stats.reparsedChunks = fresh.size();
+        for (const Chunk& c : fresh) stats.reparsedLines += c.lineCount;
+
+        splice(chunks, ci, cj - ci, fresh);
+        // Os trechos seguintes só mudam de linha: os nós deles são
+        // corrigidos no próximo program(), não a cada edição
+        if (delta != 0) {
+            for (size_t k = ci + fresh.size(); k < chunks.size(); ++k) chunks[k].firstLine += delta;
+        }
+
+        stats.reusedChunks = chunks.size() - fresh.size();
+        rootDirty = true;
+        return stats;
+    }
+
+    bool ok() const {
+        for (const Chunk& c : chunks) {
+            if (!c.block) return false;
+        }
+        return true;
+    }
+
+    // Erros e avisos, como os do parse do fonte inteiro: até o primeiro erro
+    // de sintaxe. Um trecho com erro que mudou de linha é reanalisado aqui,
+    // para que a mensagem traga a linha de agora.
+    std::string diagnostics() {
+        std::string all;
+        for (Chunk& c : chunks) {
+            if (!c.block && c.parsedAt != c.firstLine) parse(c);
+            all += c.diagnostics;
+            if (!c.block) break;
+        }
+        return all;
+    }
+
+    // O programa inteiro (nullptr se há erro de sintaxe). Os comandos são os
+    // mesmos nós dos trechos: valem até a próxima edição. As linhas dos nós
+    // de um trecho que mudou de posição são acertadas aqui.
+    Block* program() {
+        if (!ok()) return nullptr;
+        if (rootDirty) {
+            root = std::make_unique<Block>();
+            for (Chunk& c : chunks) {
+                if (c.nodesAt != c.firstLine) {
+                    int delta = (int)((long)c.firstLine - (long)c.nodesAt);
+                    for (auto& node : c.nodes) {
+                        if (node->line) node->line += delta;
+                    }
+                    c.nodesAt = c.firstLine;
+                }
+                for (Node* s : c.block->getStatements()) root->add(s);
+            }
+            rootDirty = false;
+        }
+        return root.get();
+    }
+
+    std::string text() const {
+        std::string all;
+        for (size_t l = 0; l < lines.size(); ++l) {
+            if (l > 0) all += '\n';
+            all += lines[l];
+        }
+        return all;
+    }
+
+    size_t lineCount() const { return lines.size(); }
+    size_t chunkCount() const { return chunks.size(); }
+
+    // Contexto da análise (símbolos internados), para gerar código ou
+    // executar o programa() com um CompileContext::Scope
+    CompileContext& compileContext() { return context; }
+};
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+// JIT de base do interpretador (maieutic --run): laços numéricos quentes são
+// traduzidos direto para código de máquina x86-64 (SSE2), sem biblioteca
+// externa. Só existe em Linux x86-64; nas demais plataformas nada é compilado
+// e o interpretador segue sozinho.
+#if defined(__x86_64__) && defined(__linux__)
+#define MAIEUTIC_JIT 1
+#include <sys/mman.h>
+#else
+#define MAIEUTIC_JIT 0
+#endif
+
+// Montador mínimo: os valores são doubles em xmm0/xmm1, endereços em rax.
+// Expressões deixam o resultado em xmm0; operandos pendentes vão para a
+// pilha da máquina (push/popOperand).
+class X64Emitter {
+    std::vector<uint8_t> code;
+    std::vector<long> labels;                      // label -> posição (-1: pendente)
+    std::vector<std::pair<size_t, int>> fixups;    // rel32 a corrigir -> label
+    int pushed = 0;                                // doubles na pilha (alinhamento)
+
+    void bytes(std::initializer_list<uint8_t> bs) { code.insert(code.end(), bs); }
+
+    void imm64(uint64_t v) {
+        for (int i = 0; i < 8; ++i) code.push_back((uint8_t)(v >> (8 * i)));
+    }
+
+    void rel32(int label) {
+        fixups.push_back({code.size(), label});
+        bytes({0, 0, 0, 0});
+    }
+
+    void movRax(uint64_t v) {              // mov rax, imm64
+        bytes({0x48, 0xB8});
+        imm64(v);
+    }
+
+    // Instrução SSE "prefixo 0F op" entre registradores xmm
+    void sse(uint8_t prefix, uint8_t op, int dst, int src) {
+        bytes({prefix, 0x0F, op, (uint8_t)(0xC0 | (dst << 3) | src)});
+    }
+
+public:
+    const std::vector<uint8_t>& bytesOut() const { return code; }
+
+    int newLabel() {
+        labels.push_back(-1);
+        return (int)labels.size() - 1;
+    }
+
+    void bind(int label) { labels[label] = (long)code.size(); }
+
+    void prologue() { bytes({0x55, 0x48, 0x89, 0xE5}); }   // push rbp; mov rbp, rsp
+    void epilogue() { bytes({0x5D, 0xC3}); }               // pop rbp; ret
+
+    // xmm<reg> = constante (dada pelos bits)
+    void constantBits(uint64_t bits, int reg) {
+        movRax(bits);
+        bytes({0x66, 0x48, 0x0F, 0x6E, (uint8_t)(0xC0 | (reg << 3))});   // movq xmm, rax
+    }
+
+    void constant(double d, int reg = 0) {
+        uint64_t bits;
+        std::memcpy(&bits, &d, sizeof bits);
+        constantBits(bits, reg);
+    }
+
+    void load(const double* p) {           // xmm0 = *p
+        movRax((uint64_t)p);
+        bytes({0xF2, 0x0F, 0x10, 0x00});
+    }
+
+    void store(double* p) {                // *p = xmm0
+        movRax((uint64_t)p);
+        bytes({0xF2, 0x0F, 0x11, 0x00});
+    }
+
+    void pushOperand() {                   // sub rsp, 8; movsd [rsp], xmm0
+        bytes({0x48, 0x83, 0xEC, 0x08, 0xF2, 0x0F, 0x11, 0x04, 0x24});
+        ++pushed;
+    }
+
+    // xmm1 = xmm0 (operando direito); xmm0 = operando esquerdo da pilha
+    void popOperand() {
+        sse(0x66, 0x28, 1, 0);                                     // movapd xmm1, xmm0
+        bytes({0xF2, 0x0F, 0x10, 0x04, 0x24, 0x48, 0x83, 0xC4, 0x08});
+        --pushed;
+    }
+
+    void addsd(int d, int s) { sse(0xF2, 0x58, d, s); }
+    void subsd(int d, int s) { sse(0xF2, 0x5C, d, s); }
+    void mulsd(int d, int s) { sse(0xF2, 0x59, d, s); }
+    void divsd(int d, int s) { sse(0xF2, 0x5E, d, s); }
+    void andpd(int d, int s) { sse(0x66, 0x54, d, s); }
+    void orpd(int d, int s)  { sse(0x66, 0x56, d, s); }
+    void xorpd(int d, int s) { sse(0x66, 0x57, d, s); }
+    void movapd(int d, int s) { sse(0x66, 0x28, d, s); }
+
+    // cmpsd d, s, pred (0 = igual, 1 = menor, 2 = menor ou igual): máscara em d
+    void cmpsd(int d, int s, uint8_t pred) {
+        sse(0xF2, 0xC2, d, s);
+        code.push_back(pred);
+    }
+
+    // Máscara de cmpsd em xmm0 -> 1.0 / 0.0
+    void maskToBool() {
+        constant(1.0, 1);
+        andpd(0, 1);
+    }
+
+    // xmm0 = (xmm0 <pred> xmm1) ? 1.0 : 0.0; com swap, compara xmm1 com xmm0
+    void compare(uint8_t pred, bool swap = false) {
+        if (swap) {
+            movapd(2, 1);
+            cmpsd(2, 0, pred);
+            movapd(0, 2);
+        } else {
+            cmpsd(0, 1, pred);
+        }
+        maskToBool();
+    }
+
+    // xmm0 = |xmm0 - xmm1| < eps ? 1.0 : 0.0
+    void nearlyEqual(double eps) {
+        subsd(0, 1);
+        constantBits(0x7FFFFFFFFFFFFFFFull, 1);
+        andpd(0, 1);
+        constant(eps, 1);
+        compare(1);
+    }
+
+    // xmm0 = xmm1 == 0 ? 0.0 : xmm0 / xmm1
+    void divOrZero() {
+        xorpd(2, 2);
+        bytes({0x66, 0x0F, 0x2E, 0xCA});                           // ucomisd xmm1, xmm2
+        bytes({0x7A, 0x08});                                       // jp divide (NaN)
+        bytes({0x75, 0x06});                                       // jne divide
+        xorpd(0, 0);
+        bytes({0xEB, 0x04});                                       // jmp done
+        divsd(0, 1);                                               // divide:
+    }                                                              // done:
+
+    // xmm0 = fn(xmm0, xmm1), respeitando o alinhamento de 16 bytes da ABI
+    void call(double (*fn)(double, double)) {
+        bool pad = pushed % 2 != 0;
+        if (pad) bytes({0x48, 0x83, 0xEC, 0x08});
+        movRax((uint64_t)fn);
+        bytes({0xFF, 0xD0});                                       // call rax
+        if (pad) bytes({0x48, 0x83, 0xC4, 0x08});
+    }
+
+    // Salta se xmm0 é falso (0.0); NaN conta como verdadeiro, como em numVal != 0
+    void jumpIfFalse(int label) {
+        xorpd(1, 1);
+        bytes({0x66, 0x0F, 0x2E, 0xC1});                           // ucomisd xmm0, xmm1
+        bytes({0x7A, 0x06});                                       // jp +6 (NaN)
+        bytes({0x0F, 0x84});                                       // je label
+        rel32(label);
+    }
+
+    void jump(int label) {
+        code.push_back(0xE9);
+        rel32(label);
+    }
+
+    // Resolve os saltos; devolve false se algum label ficou sem posição
+    bool finish() {
+        for (auto& f : fixups) {
+            long target = labels[f.second];
+            if (target < 0) return false;
+            int32_t rel = (int32_t)(target - (long)(f.first + 4));
+            std::memcpy(&code[f.first], &rel, 4);
+        }
+        fixups.clear();
+        return true;
+    }
+};
+
+// Código executável em memória obtida com mmap (escrita, depois só execução)
+class JitCode {
+    void* mem = nullptr;
+    size_t size = 0;
+public:
+    JitCode() = default;
+    JitCode(const JitCode&) = delete;
+    JitCode& operator=(const JitCode&) = delete;
+
+    ~JitCode() {
+#if MAIEUTIC_JIT
+        if (mem) munmap(mem, size);
+#endif
+    }
+
+    bool load(const std::vector<uint8_t>& bytes) {
+#if MAIEUTIC_JIT
+        size = bytes.size();
+        mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED) {
+            mem = nullptr;
+            return false;
+        }
+        std::memcpy(mem, bytes.data(), size);
+        return mprotect(mem, size, PROT_READ | PROT_EXEC) == 0;
+#else
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    void run() const { reinterpret_cast<void (*)()>(mem)(); }
+};
+
+#endif
@@ -0,0 +1,369 @@
+#ifndef LINKER_H
+#define LINKER_H
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "emitter.h"
+#include "stackdepth.h"
+
+// Compilação separada e ligação (Importar "modulo.ms"). Cada fonte é
+// compilado sozinho para uma unidade: o assembly de sempre, com ".UNIT
+// <fonte>" no cabeçalho e ".IMPORT <caminho>" onde o fonte importa um
+// módulo. Ligar é trocar cada .IMPORT pelo corpo do módulo:
+//
+//  - slots: a tabela final começa com os do programa, na mesma ordem; as
+//    variáveis dos módulos são ligadas pelo nome (.SYM) e os nomes novos
+//    ganham os slots seguintes;
+//  - labels e sites de cada cópia de um módulo ganham o prefixo
+//    "<módulo><n>." (os ids de nextLabelId() recomeçam em cada unidade);
+//  - o código frio dos módulos vai para depois do HALT, com o do programa;
+//  - a tabela de linhas (-g) continua valendo: ".FILE" passa a ser o
+//    caminho do fonte de cada cópia, e depois do código de um módulo volta
+//    o .FILE/.LINE de quem o importou.
+//
+// As unidades dos módulos ficam em cache ao lado do fonte (modulo.ms ->
+// modulo.mo). Quem importa guarda só o .IMPORT: alterar um módulo recompila
+// o módulo e liga de novo, sem recompilar quem o importa.
+
+// Caminho de um módulo importado: relativo ao diretório de quem importa
+inline std::string resolveImport(const std::string& importer, const std::string& path) {
+    std::filesystem::path p(path);
+    if (p.is_relative()) p = std::filesystem::path(importer).parent_path() / p;
+    return p.lexically_normal().generic_string();
+}
+
+inline std::string unitPathOf(const std::string& source) {
+    return std::filesystem::path(source).replace_extension(".mo").string();
+}
+
+inline bool readWholeFile(const std::string& path, std::string& text) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Uma unidade, lida do texto gerado pelo compilador
+struct AsmUnit {
+    std::string source;                 // .UNIT: fonte compilado
+    std::string codegen;                // .CODEGEN: opções de geração usadas
+    std::string sourceHash;             // .SOURCE_HASH: hash do fonte (perfil)
+    std::vector<std::string> comments;  // comentários do cabeçalho ("; Fonte: ...")
+    std::vector<std::string> slots;     // .SYM: nome de cada slot
+    std::vector<std::string> body;      // até o HALT
+    std::vector<std::string> cold;      // depois do HALT
+    bool lineTable = false;             // compilada com -g (tem .FILE)
+
+    bool parse(std::string_view text, std::string& error) {
+        bool header = true, halted = false;
+        while (!text.empty()) {
+            size_t nl = text.find('\n');
+            std::string_view line = text.substr(0, nl);
+            text = nl == std::string_view::npos ? std::string_view() : text.substr(nl + 1);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            if (line.empty()) continue;
+            if (line[0] == ';') {
+                if (header) comments.emplace_back(line);
+                continue;
+            }
+
+            size_t space = line.find(' ');
+            std::string_view op = line.substr(0, space);
+            std::string_view arg = space == std::string_view::npos ? std::string_view() : line.substr(space + 1);
+            if (header) {
+                if (op == ".UNIT") {
+                    source = arg;
+                    continue;
+                }
+                if (op == ".CODEGEN") {
+                    codegen = arg;
+                    continue;
+                }
+                if (op == ".SOURCE_HASH") {
+                    sourceHash = arg;
+                    continue;
+                }
+                if (op == ".SLOTS" || op == ".STACK") continue;
+                if (op == ".SYM") {
+                    size_t nameAt = arg.find(' ');
+                    size_t slot = std::strtoul(std::string(arg.substr(0, nameAt)).c_str(), nullptr, 10);
+                    if (nameAt == std::string_view::npos || slot > (1u << 24)) {
+                        error = "diretiva .SYM inválida: " + std::string(line);
+                        return false;
+                    }
+                    if (slot >= slots.size()) slots.resize(slot + 1);
+                    slots[slot] = arg.substr(nameAt + 1);
+                    continue;
+                }
+                header = false;
+            }
+            if (!halted && line == "HALT") {
+                halted = true;
+                continue;
+            }
+            if (op == ".FILE") lineTable = true;
+            (halted ? cold : body).emplace_back(line);
+        }
+        if (source.empty()) {
+            error = "não é uma unidade (falta .UNIT)";
+            return false;
+        }
+        if (!halted) {
+            error = "unidade sem HALT";
+            return false;
+        }
+        return true;
+    }
+};
+
+// Unidades dos módulos importados, em memória e em disco. Uma unidade vale
+// enquanto o fonte não for mais novo que ela e as opções de geração forem
+// as mesmas. Compartilhado pelas threads do -j e do --serve.
+class ModuleCache {
+public:
+    // Compila o fonte como unidade; false com as mensagens em `errors`
+    using Compiler = std::function<bool(const std::string& source, AsmEmitter& unit, std::string& errors)>;
+
+    ModuleCache(std::string codegenOptions, Compiler compiler)
+        : codegen(std::move(codegenOptions)), compile(std::move(compiler)) {}
+
+    std::shared_ptr<const AsmUnit> load(const std::string& source, std::string& errors) {
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        auto stamp = fs::last_write_time(source, ec);
+        if (ec) {
+            errors += "Erro ao abrir o módulo: " + source + "\n";
+            return nullptr;
+        }
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            auto it = units.find(source);
+            if (it != units.end() && it->second.stamp == stamp) return it->second.unit;
+        }
+
+        auto unit = std::make_shared<AsmUnit>();
+        std::string cached = unitPathOf(source), text, error;
+        auto cachedStamp = fs::last_write_time(cached, ec);
+        bool fresh = !ec && cachedStamp >= stamp && readWholeFile(cached, text)
+                  && unit->parse(text, error) && unit->codegen == codegen;
+        if (!fresh) {
+            AsmEmitter out(4096);
+            if (!compile(source, out, errors)) return nullptr;
+            *unit = AsmUnit();
+            if (!unit->parse(out.view(), error)) {
+                errors += source + ": " + error + "\n";
+                return nullptr;
+            }
+            // Grava num temporário e renomeia: outra thread ou outro processo
+            // compilando o mesmo módulo nunca lê uma unidade pela metade. Se
+            // não der para gravar, a unidade fica só em memória.
+            std::string temp = cached + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+                                                                (size_t)std::chrono::steady_clock::now().time_since_epoch().count());
+            if (out.writeTo(temp)) {
+                fs::rename(temp, cached, ec);
+                if (ec) fs::remove(temp, ec);
+            }
+        }
+        // A unidade em disco pode ter sido gerada a partir de outro caminho
+        // para o mesmo fonte: os imports dela são relativos a este
+        unit->source = source;
+
+        std::lock_guard<std::mutex> guard(lock);
+        units[source] = Entry{stamp, unit};
+        return unit;
+    }
+
+private:
+    struct Entry {
+        std::filesystem::file_time_type stamp;
+        std::shared_ptr<const AsmUnit> unit;
+    };
+
+    std::string codegen;
+    Compiler compile;
+    std::mutex lock;
+    std::map<std::string, Entry> units;
+};
+
+// Liga um programa e os módulos que ele importa num programa só, no formato
+// que a SocraticVM lê
+class Linker {
+    struct Copy {
+        const AsmUnit* unit;
+        std::string prefix;                 // "" no programa principal
+        std::vector<int> slots;             // slot da unidade -> slot final
+        std::vector<std::string> chain;     // importações até aqui (ciclos)
+    };
+
+    ModuleCache& modules;
+    std::vector<std::string> slotNames;
+    std::unordered_map<std::string, int> slotIds;
+    std::deque<Copy> copies;                               // endereços estáveis
+    std::vector<std::shared_ptr<const AsmUnit>> loaded;
+    std::map<std::string, int> copiesOf;                   // por nome, para os prefixos
+    std::vector<std::string> moduleNames;
+    std::string* errors = nullptr;
+    bool importFailed = false;                              // módulo inexistente, circular ou com erro
+
+    int slotOf(const std::string& name) {
+        auto it = slotIds.find(name);
+        if (it != slotIds.end()) return it->second;
+        int slot = (int)slotNames.size();
+        slotIds.emplace(name, slot);
+        slotNames.push_back(name);
+        return slot;
+    }
+
+    static bool isLabelOp(std::string_view op) {
+        return op == "LABEL" || op == "JUMP" || op == "JUMP_IF_FALSE" || op == "JUMP_IF_TRUE";
+    }
+
+    static bool isSlotOp(std::string_view op) {
+        return op == "LOAD_SLOT" || op == "STORE_SLOT" || op == "APPEND_SLOT"
+            || op == "STORE_INDEX_SLOT" || op == "INPUT_SLOT";
+    }
+
+    // Cópia nova de `unit`: os slots são ligados pelo nome agora, antes do
+    // corpo, para que a ordem da tabela final não dependa dos saltos
+    const Copy& addCopy(const AsmUnit* unit, std::string prefix, std::vector<std::string> chain) {
+        Copy copy{unit, std::move(prefix), {}, std::move(chain)};
+        for (const auto& name : unit->slots) copy.slots.push_back(slotOf(name));
+        copies.push_back(std::move(copy));
+        return copies.back();
+    }
+
+    bool place(const Copy& copy, const std::vector<std::string>& lines, AsmEmitter& out) {
+        if (copy.unit->lineTable && !lines.empty()) out.put(".FILE ").put(copy.unit->source).put('\n');
+        std::string_view lastLine;   // .LINE em vigor, para voltar a ela depois de um módulo
+        for (const std::string& line : lines) {
+            size_t space = line.find(' ');
+            std::string_view op = std::string_view(line).substr(0, space);
+            std::string_view arg = space == std::string::npos ? std::string_view() : std::string_view(line).substr(space + 1);
+
+            if (isLabelOp(op) || op == ".SITE") {
+                out.put(op).put(' ').put(copy.prefix).put(arg).put('\n');
+            } else if (isSlotOp(op)) {
+                char* end;
+                size_t slot = std::strtoul(std::string(arg).c_str(), &end, 10);
+                if (arg.empty() || *end != '\0' || slot >= copy.slots.size()) {
+                    *errors += copy.unit->source + ": slot sem .SYM: " + line + "\n";
+                    return false;
+                }
+                out.put(op).put(' ').put(copy.slots[slot]).put('\n');
+            } else if (op == ".IMPORT") {
+                if (!placeModule(copy, std::string(arg), out)) return false;
+                if (copy.unit->lineTable) {
+                    out.put(".FILE ").put(copy.unit->source).put('\n');
+                    if (!lastLine.empty()) out.put(lastLine).put('\n');
+                }
+            } else if (op == ".FILE") {
+                continue;   // já posto no início, com o caminho da cópia
+            } else {
+                if (op == ".LINE") lastLine = line;
+                out.put(line).put('\n');
+            }
+        }
+        return true;
+    }
+
+    bool placeModule(const Copy& importer, const std::string& path, AsmEmitter& out) {
+        std::string source = resolveImport(importer.unit->source, path);
+        for (const auto& active : importer.chain) {
+            if (active == source) {
+                *errors += importer.unit->source + ": importação circular de " + source + "\n";
+                importFailed = true;
+                return false;
+            }
+        }
+        auto unit = modules.load(source, *errors);
+        if (!unit) {
+            importFailed = true;
+            return false;
+        }
+        loaded.push_back(unit);
+
+        std::string name = std::filesystem::path(source).stem().string();
+        for (char& c : name) {
+            if (!std::isalnum((unsigned char)c) && c != '_') c = '_';
+        }
+        int n = ++copiesOf[name];
+        if (std::find(moduleNames.begin(), moduleNames.end(), source) == moduleNames.end()) moduleNames.push_back(source);
+
+        std::vector<std::string> chain = importer.chain;
+        chain.push_back(source);
+        const Copy& copy = addCopy(unit.get(), name + std::to_string(n) + ".", std::move(chain));
+        out.put("; Importar ").put(source).put('\n');
+        return place(copy, unit->body, out);
+    }
+
+public:
+    explicit Linker(ModuleCache& cache) : modules(cache) {}
+
+    // Depois de um link() que falhou: a falha foi num Importar (e não no
+    // assembly das unidades ou na pilha do programa ligado)
+    bool failedToImport() const { return importFailed; }
+
+    bool link(const AsmUnit& main, AsmEmitter& out, std::string& messages) {
+        errors = &messages;
+        std::string self = std::filesystem::path(main.source).lexically_normal().generic_string();
+        addCopy(&main, "", {self});
+
+        AsmEmitter body(1 << 16), cold(4096);
+        if (!place(copies.front(), main.body, body)) return false;
+        // O código frio de cada cópia, inclusive das que aparecem no código
+        // frio de outra (a fila cresce durante o laço)
+        for (size_t i = 0; i < copies.size(); ++i) {
+            if (!place(copies[i], copies[i].unit->cold, cold)) return false;
+        }
+
+        size_t stackDepth;
+        std::string stackError;
+        StackDepth stack;
+        if (!(stack.add(body.view(), stackError) && stack.add("HALT\n", stackError)
+              && stack.add(cold.view(), stackError) && stack.analyze(stackDepth, stackError))) {
+            messages += main.source + ": pilha do programa ligado: " + stackError + "\n";
+            return false;
+        }
+
+        out = AsmEmitter(body.size() + cold.size() + 4096);
+        out.put("; Arquivo gerado pelo compilador Maiêutic\n");
+        for (const auto& comment : main.comments) {
+            if (comment.rfind("; Unidade", 0) != 0) out.put(comment).put('\n');
+        }
+        for (const auto& module : moduleNames) out.put("; Módulo: ").put(module).put('\n');
+        out.put('\n');
+
+        // O perfil do programa ligado é do fonte principal
+        if (!main.sourceHash.empty()) out.put(".SOURCE_HASH ").put(main.sourceHash).put('\n');
+        out.put(".STACK ").put(stackDepth).put('\n');
+        out.put(".SLOTS ").put(slotNames.size()).put('\n');
+        for (size_t i = 0; i < slotNames.size(); ++i) {
+            out.put(".SYM ").put(i).put(' ').put(slotNames[i]).put('\n');
+        }
+        out.put('\n');
+        out.append(body);
+        out.put("\nHALT\n");
+        if (cold.size() > 0) {
+            out.put("\n; Código frio (pouco executado segundo o perfil)\n");
+            out.append(cold);
+        }
+        return true;
+    }
+};
+
+#endif
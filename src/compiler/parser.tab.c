@@ -1,2066 +0,0 @@
-/* A Bison parser, made by GNU Bison 3.8.2.  */
-
-/* Bison implementation for Yacc-like parsers in C
-
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
-   Inc.
-
-   This program is free software: you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation, either version 3 of the License, or
-   (at your option) any later version.
-
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
-
-   You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
-
-/* As a special exception, you may create a larger work that contains
-   part or all of the Bison parser skeleton and distribute that work
-   under terms of your choice, so long as that work isn't itself a
-   parser generator using the skeleton or a modified version thereof
-   as a parser skeleton.  Alternatively, if you modify or redistribute
-   the parser skeleton itself, you may (at your option) remove this
-   special exception, which will cause the skeleton and the resulting
-   Bison output files to be licensed under the GNU General Public
-   License without this special exception.
-
-   This special exception was added by the Free Software Foundation in
-   version 2.2 of Bison.  */
-
-/* C LALR(1) parser skeleton written by Richard Stallman, by
-   simplifying the original so-called "semantic" parser.  */
-
-/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
-   especially those whose name start with YY_ or yy_.  They are
-   private implementation details that can be changed or removed.  */
-
-/* All symbols defined below should begin with yy or YY, to avoid
-   infringing on user name space.  This should be done even for local
-   variables, as they might otherwise be expanded by user macros.
-   There are some unavoidable exceptions within include files to
-   define necessary library symbols; they are noted "INFRINGES ON
-   USER NAME SPACE" below.  */
-
-/* Identify Bison output, and Bison version.  */
-#define YYBISON 30802
-
-/* Bison version string.  */
-#define YYBISON_VERSION "3.8.2"
-
-/* Skeleton name.  */
-#define YYSKELETON_NAME "yacc.c"
-
-/* Pure parsers.  */
-#define YYPURE 0
-
-/* Push parsers.  */
-#define YYPUSH 0
-
-/* Pull parsers.  */
-#define YYPULL 1
-
-
-
-
-/* First part of user prologue.  */
-#line 1 "parser.y"
-
-#include <iostream>
-#include <vector>
-#include <string>
-#include <stack>
-#include <cstdio>
-#include <fstream>
-#include "ast.h"
-
-extern int yylex();
-extern int yylineno;
-extern FILE* yyin;
-extern std::stack<int> indent_stack; 
-void yyerror(const char *s);
-
-Block* rootBlock = nullptr;
-
-#line 89 "parser.tab.c"
-
-# ifndef YY_CAST
-#  ifdef __cplusplus
-#   define YY_CAST(Type, Val) static_cast<Type> (Val)
-#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
-#  else
-#   define YY_CAST(Type, Val) ((Type) (Val))
-#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
-#  endif
-# endif
-# ifndef YY_NULLPTR
-#  if defined __cplusplus
-#   if 201103L <= __cplusplus
-#    define YY_NULLPTR nullptr
-#   else
-#    define YY_NULLPTR 0
-#   endif
-#  else
-#   define YY_NULLPTR ((void*)0)
-#  endif
-# endif
-
-#include "parser.tab.h"
-/* Symbol kind.  */
-enum yysymbol_kind_t
-{
-  YYSYMBOL_YYEMPTY = -2,
-  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
-  YYSYMBOL_YYerror = 1,                    /* error  */
-  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
-  YYSYMBOL_VAR_ID = 3,                     /* VAR_ID  */
-  YYSYMBOL_LIT_STRING = 4,                 /* LIT_STRING  */
-  YYSYMBOL_LIT_NUMBER = 5,                 /* LIT_NUMBER  */
-  YYSYMBOL_LIT_BOOL = 6,                   /* LIT_BOOL  */
-  YYSYMBOL_TOKEN_INDENT = 7,               /* TOKEN_INDENT  */
-  YYSYMBOL_TOKEN_DEDENT = 8,               /* TOKEN_DEDENT  */
-  YYSYMBOL_KW_SE = 9,                      /* KW_SE  */
-  YYSYMBOL_KW_SENAO = 10,                  /* KW_SENAO  */
-  YYSYMBOL_KW_ENQUANTO = 11,               /* KW_ENQUANTO  */
-  YYSYMBOL_KW_TAMANHO = 12,                /* KW_TAMANHO  */
-  YYSYMBOL_OP_ASSIGN = 13,                 /* OP_ASSIGN  */
-  YYSYMBOL_OP_APPEND = 14,                 /* OP_APPEND  */
-  YYSYMBOL_OP_ARROW = 15,                  /* OP_ARROW  */
-  YYSYMBOL_OP_EQ = 16,                     /* OP_EQ  */
-  YYSYMBOL_OP_NEQ = 17,                    /* OP_NEQ  */
-  YYSYMBOL_OP_GTE = 18,                    /* OP_GTE  */
-  YYSYMBOL_OP_LTE = 19,                    /* OP_LTE  */
-  YYSYMBOL_OP_LT = 20,                     /* OP_LT  */
-  YYSYMBOL_OP_GT = 21,                     /* OP_GT  */
-  YYSYMBOL_OP_LOG = 22,                    /* OP_LOG  */
-  YYSYMBOL_OP_QUEST = 23,                  /* OP_QUEST  */
-  YYSYMBOL_OP_CONCL = 24,                  /* OP_CONCL  */
-  YYSYMBOL_COLON = 25,                     /* COLON  */
-  YYSYMBOL_COMMA = 26,                     /* COMMA  */
-  YYSYMBOL_LBRACKET = 27,                  /* LBRACKET  */
-  YYSYMBOL_RBRACKET = 28,                  /* RBRACKET  */
-  YYSYMBOL_LPAREN = 29,                    /* LPAREN  */
-  YYSYMBOL_RPAREN = 30,                    /* RPAREN  */
-  YYSYMBOL_PLUS = 31,                      /* PLUS  */
-  YYSYMBOL_MINUS = 32,                     /* MINUS  */
-  YYSYMBOL_MULT = 33,                      /* MULT  */
-  YYSYMBOL_DIV = 34,                       /* DIV  */
-  YYSYMBOL_MOD = 35,                       /* MOD  */
-  YYSYMBOL_OP_AND = 36,                    /* OP_AND  */
-  YYSYMBOL_OP_OR = 37,                     /* OP_OR  */
-  YYSYMBOL_NEWLINE = 38,                   /* NEWLINE  */
-  YYSYMBOL_YYACCEPT = 39,                  /* $accept  */
-  YYSYMBOL_program = 40,                   /* program  */
-  YYSYMBOL_opt_newlines = 41,              /* opt_newlines  */
-  YYSYMBOL_statements = 42,                /* statements  */
-  YYSYMBOL_block = 43,                     /* block  */
-  YYSYMBOL_statement = 44,                 /* statement  */
-  YYSYMBOL_assignment = 45,                /* assignment  */
-  YYSYMBOL_question = 46,                  /* question  */
-  YYSYMBOL_input_ans = 47,                 /* input_ans  */
-  YYSYMBOL_output = 48,                    /* output  */
-  YYSYMBOL_conclusion = 49,                /* conclusion  */
-  YYSYMBOL_conditional = 50,               /* conditional  */
-  YYSYMBOL_loop = 51,                      /* loop  */
-  YYSYMBOL_expression = 52,                /* expression  */
-  YYSYMBOL_logic_expr = 53,                /* logic_expr  */
-  YYSYMBOL_comp_expr = 54,                 /* comp_expr  */
-  YYSYMBOL_math_expr = 55,                 /* math_expr  */
-  YYSYMBOL_term = 56,                      /* term  */
-  YYSYMBOL_factor = 57,                    /* factor  */
-  YYSYMBOL_list_def = 58,                  /* list_def  */
-  YYSYMBOL_list_items = 59                 /* list_items  */
-};
-typedef enum yysymbol_kind_t yysymbol_kind_t;
-
-
-
-
-#ifdef short
-# undef short
-#endif
-
-/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
-   <limits.h> and (if available) <stdint.h> are included
-   so that the code can choose integer types of a good width.  */
-
-#ifndef __PTRDIFF_MAX__
-# include <limits.h> /* INFRINGES ON USER NAME SPACE */
-# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
-#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
-#  define YY_STDINT_H
-# endif
-#endif
-
-/* Narrow types that promote to a signed type and that can represent a
-   signed or unsigned integer of at least N bits.  In tables they can
-   save space and decrease cache pressure.  Promoting to a signed type
-   helps avoid bugs in integer arithmetic.  */
-
-#ifdef __INT_LEAST8_MAX__
-typedef __INT_LEAST8_TYPE__ yytype_int8;
-#elif defined YY_STDINT_H
-typedef int_least8_t yytype_int8;
-#else
-typedef signed char yytype_int8;
-#endif
-
-#ifdef __INT_LEAST16_MAX__
-typedef __INT_LEAST16_TYPE__ yytype_int16;
-#elif defined YY_STDINT_H
-typedef int_least16_t yytype_int16;
-#else
-typedef short yytype_int16;
-#endif
-
-/* Work around bug in HP-UX 11.23, which defines these macros
-   incorrectly for preprocessor constants.  This workaround can likely
-   be removed in 2023, as HPE has promised support for HP-UX 11.23
-   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
-   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
-#ifdef __hpux
-# undef UINT_LEAST8_MAX
-# undef UINT_LEAST16_MAX
-# define UINT_LEAST8_MAX 255
-# define UINT_LEAST16_MAX 65535
-#endif
-
-#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
-typedef __UINT_LEAST8_TYPE__ yytype_uint8;
-#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
-       && UINT_LEAST8_MAX <= INT_MAX)
-typedef uint_least8_t yytype_uint8;
-#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
-typedef unsigned char yytype_uint8;
-#else
-typedef short yytype_uint8;
-#endif
-
-#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
-typedef __UINT_LEAST16_TYPE__ yytype_uint16;
-#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
-       && UINT_LEAST16_MAX <= INT_MAX)
-typedef uint_least16_t yytype_uint16;
-#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
-typedef unsigned short yytype_uint16;
-#else
-typedef int yytype_uint16;
-#endif
-
-#ifndef YYPTRDIFF_T
-# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
-#  define YYPTRDIFF_T __PTRDIFF_TYPE__
-#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
-# elif defined PTRDIFF_MAX
-#  ifndef ptrdiff_t
-#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
-#  endif
-#  define YYPTRDIFF_T ptrdiff_t
-#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
-# else
-#  define YYPTRDIFF_T long
-#  define YYPTRDIFF_MAXIMUM LONG_MAX
-# endif
-#endif
-
-#ifndef YYSIZE_T
-# ifdef __SIZE_TYPE__
-#  define YYSIZE_T __SIZE_TYPE__
-# elif defined size_t
-#  define YYSIZE_T size_t
-# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
-#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
-#  define YYSIZE_T size_t
-# else
-#  define YYSIZE_T unsigned
-# endif
-#endif
-
-#define YYSIZE_MAXIMUM                                  \
-  YY_CAST (YYPTRDIFF_T,                                 \
-           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
-            ? YYPTRDIFF_MAXIMUM                         \
-            : YY_CAST (YYSIZE_T, -1)))
-
-#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
-
-
-/* Stored state numbers (used for stacks). */
-typedef yytype_int8 yy_state_t;
-
-/* State numbers in computations.  */
-typedef int yy_state_fast_t;
-
-#ifndef YY_
-# if defined YYENABLE_NLS && YYENABLE_NLS
-#  if ENABLE_NLS
-#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
-#  endif
-# endif
-# ifndef YY_
-#  define YY_(Msgid) Msgid
-# endif
-#endif
-
-
-#ifndef YY_ATTRIBUTE_PURE
-# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
-#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
-# else
-#  define YY_ATTRIBUTE_PURE
-# endif
-#endif
-
-#ifndef YY_ATTRIBUTE_UNUSED
-# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
-#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
-# else
-#  define YY_ATTRIBUTE_UNUSED
-# endif
-#endif
-
-/* Suppress unused-variable warnings by "using" E.  */
-#if ! defined lint || defined __GNUC__
-# define YY_USE(E) ((void) (E))
-#else
-# define YY_USE(E) /* empty */
-#endif
-
-/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
-# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
-#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
-    _Pragma ("GCC diagnostic push")                                     \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
-# else
-#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
-    _Pragma ("GCC diagnostic push")                                     \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
-    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# endif
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
-    _Pragma ("GCC diagnostic pop")
-#else
-# define YY_INITIAL_VALUE(Value) Value
-#endif
-#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END
-#endif
-#ifndef YY_INITIAL_VALUE
-# define YY_INITIAL_VALUE(Value) /* Nothing. */
-#endif
-
-#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
-# define YY_IGNORE_USELESS_CAST_BEGIN                          \
-    _Pragma ("GCC diagnostic push")                            \
-    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
-# define YY_IGNORE_USELESS_CAST_END            \
-    _Pragma ("GCC diagnostic pop")
-#endif
-#ifndef YY_IGNORE_USELESS_CAST_BEGIN
-# define YY_IGNORE_USELESS_CAST_BEGIN
-# define YY_IGNORE_USELESS_CAST_END
-#endif
-
-
-#define YY_ASSERT(E) ((void) (0 && (E)))
-
-#if 1
-
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
-
-# ifdef YYSTACK_USE_ALLOCA
-#  if YYSTACK_USE_ALLOCA
-#   ifdef __GNUC__
-#    define YYSTACK_ALLOC __builtin_alloca
-#   elif defined __BUILTIN_VA_ARG_INCR
-#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#   elif defined _AIX
-#    define YYSTACK_ALLOC __alloca
-#   elif defined _MSC_VER
-#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#    define alloca _alloca
-#   else
-#    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
-#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
-#     ifndef EXIT_SUCCESS
-#      define EXIT_SUCCESS 0
-#     endif
-#    endif
-#   endif
-#  endif
-# endif
-
-# ifdef YYSTACK_ALLOC
-   /* Pacify GCC's 'empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
-#  ifndef YYSTACK_ALLOC_MAXIMUM
-    /* The OS might guarantee only one guard page at the bottom of the stack,
-       and a page size can be as small as 4096 bytes.  So we cannot safely
-       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
-       to allow for a few compiler-allocated temporary stack slots.  */
-#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
-#  endif
-# else
-#  define YYSTACK_ALLOC YYMALLOC
-#  define YYSTACK_FREE YYFREE
-#  ifndef YYSTACK_ALLOC_MAXIMUM
-#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
-#  endif
-#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
-       && ! ((defined YYMALLOC || defined malloc) \
-             && (defined YYFREE || defined free)))
-#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef EXIT_SUCCESS
-#    define EXIT_SUCCESS 0
-#   endif
-#  endif
-#  ifndef YYMALLOC
-#   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS
-void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
-#   endif
-#  endif
-#  ifndef YYFREE
-#   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS
-void free (void *); /* INFRINGES ON USER NAME SPACE */
-#   endif
-#  endif
-# endif
-#endif /* 1 */
-
-#if (! defined yyoverflow \
-     && (! defined __cplusplus \
-         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
-
-/* A type that is properly aligned for any stack member.  */
-union yyalloc
-{
-  yy_state_t yyss_alloc;
-  YYSTYPE yyvs_alloc;
-};
-
-/* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
-
-/* The size of an array large to enough to hold all stacks, each with
-   N elements.  */
-# define YYSTACK_BYTES(N) \
-     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
-      + YYSTACK_GAP_MAXIMUM)
-
-# define YYCOPY_NEEDED 1
-
-/* Relocate STACK from its old location to the new one.  The
-   local variables YYSIZE and YYSTACKSIZE give the old and new number of
-   elements in the stack, and YYPTR gives the new location of the
-   stack.  Advance YYPTR to a properly aligned location for the next
-   stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
-    do                                                                  \
-      {                                                                 \
-        YYPTRDIFF_T yynewbytes;                                         \
-        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
-        Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
-      }                                                                 \
-    while (0)
-
-#endif
-
-#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from SRC to DST.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
-#  else
-#   define YYCOPY(Dst, Src, Count)              \
-      do                                        \
-        {                                       \
-          YYPTRDIFF_T yyi;                      \
-          for (yyi = 0; yyi < (Count); yyi++)   \
-            (Dst)[yyi] = (Src)[yyi];            \
-        }                                       \
-      while (0)
-#  endif
-# endif
-#endif /* !YYCOPY_NEEDED */
-
-/* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  3
-/* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   101
-
-/* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  39
-/* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  21
-/* YYNRULES -- Number of rules.  */
-#define YYNRULES  55
-/* YYNSTATES -- Number of states.  */
-#define YYNSTATES  105
-
-/* YYMAXUTOK -- Last valid token kind.  */
-#define YYMAXUTOK   293
-
-
-/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
-   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
-   : YYSYMBOL_YYUNDEF)
-
-/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex.  */
-static const yytype_int8 yytranslate[] =
-{
-       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38
-};
-
-#if YYDEBUG
-/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint8 yyrline[] =
-{
-       0,    56,    56,    59,    61,    66,    67,    68,    72,    76,
-      77,    78,    79,    80,    81,    82,    86,    87,    88,    93,
-      97,   101,   105,   109,   111,   116,   120,   124,   125,   126,
-     130,   131,   132,   133,   134,   135,   136,   140,   141,   142,
-     146,   147,   148,   149,   153,   154,   155,   156,   157,   158,
-     159,   160,   164,   165,   169,   170
-};
-#endif
-
-/** Accessing symbol of state STATE.  */
-#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
-
-#if 1
-/* The user-facing name of the symbol whose (internal) number is
-   YYSYMBOL.  No bounds checking.  */
-static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
-
-/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
-static const char *const yytname[] =
-{
-  "\"end of file\"", "error", "\"invalid token\"", "VAR_ID", "LIT_STRING",
-  "LIT_NUMBER", "LIT_BOOL", "TOKEN_INDENT", "TOKEN_DEDENT", "KW_SE",
-  "KW_SENAO", "KW_ENQUANTO", "KW_TAMANHO", "OP_ASSIGN", "OP_APPEND",
-  "OP_ARROW", "OP_EQ", "OP_NEQ", "OP_GTE", "OP_LTE", "OP_LT", "OP_GT",
-  "OP_LOG", "OP_QUEST", "OP_CONCL", "COLON", "COMMA", "LBRACKET",
-  "RBRACKET", "LPAREN", "RPAREN", "PLUS", "MINUS", "MULT", "DIV", "MOD",
-  "OP_AND", "OP_OR", "NEWLINE", "$accept", "program", "opt_newlines",
-  "statements", "block", "statement", "assignment", "question",
-  "input_ans", "output", "conclusion", "conditional", "loop", "expression",
-  "logic_expr", "comp_expr", "math_expr", "term", "factor", "list_def",
-  "list_items", YY_NULLPTR
-};
-
-static const char *
-yysymbol_name (yysymbol_kind_t yysymbol)
-{
-  return yytname[yysymbol];
-}
-#endif
-
-#define YYPACT_NINF (-87)
-
-#define yypact_value_is_default(Yyn) \
-  ((Yyn) == YYPACT_NINF)
-
-#define YYTABLE_NINF (-1)
-
-#define yytable_value_is_error(Yyn) \
-  0
-
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-static const yytype_int8 yypact[] =
-{
-     -87,     6,     5,   -87,    -3,    42,     3,    20,    42,    42,
-      42,   -87,   -13,   -87,   -87,   -87,   -87,   -87,   -87,   -87,
-     -87,    42,    42,    42,    12,   -87,   -87,   -87,    26,    32,
-      42,    37,   -18,   -87,    62,    -2,   -87,   -87,    42,   -87,
-     -87,   -87,   -87,    53,    25,   -87,   -87,    38,    42,    67,
-     -87,   -87,   -19,    43,    65,    42,    42,    42,    42,    42,
-      42,    42,    42,    42,    42,    42,    42,    42,    66,   -87,
-      79,    68,    69,    42,   -87,   -87,   -87,   -87,   -87,   -87,
-      10,    10,    10,    10,    10,    10,    -2,    -2,   -87,   -87,
-     -87,    65,    42,   -87,   -87,   -87,     5,    80,   -87,    -4,
-      87,   -87,    73,    65,   -87
-};
-
-/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE does not specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_int8 yydefact[] =
-{
-       3,     0,     0,     1,     0,     0,     0,     0,     0,     0,
-       0,     4,     3,     5,     9,    10,    11,    12,    13,    14,
-      15,     0,     0,     0,    48,    46,    45,    47,     0,     0,
-       0,     0,    26,    29,    36,    39,    43,    50,     0,    20,
-      21,    19,    22,     7,     2,    16,    17,     0,     0,     0,
-      52,    55,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     6,
-       0,     0,     0,     0,    53,    44,     3,    25,    27,    28,
-      30,    31,    35,    33,    32,    34,    37,    38,    40,    41,
-      42,     0,     0,    49,    51,    54,     0,    23,    18,     0,
-       0,     8,     0,     0,    24
-};
-
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int8 yypgoto[] =
-{
-     -87,   -87,    -9,     4,   -86,    58,   -87,   -87,   -87,   -87,
-     -87,   -87,   -87,    -8,   -87,     2,    28,   -11,   -16,   -87,
-     -87
-};
-
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
-{
-       0,     1,     2,    12,    77,    13,    14,    15,    16,    17,
-      18,    19,    20,    31,    32,    33,    34,    35,    36,    37,
-      52
-};
-
-/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule whose
-   number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_int8 yytable[] =
-{
-      40,    41,    42,    44,   101,    97,     3,    73,     4,    74,
-      21,    22,    38,    45,    46,    47,     5,   104,    55,    56,
-       6,    51,    53,    39,    23,    43,     7,     8,     9,    10,
-      68,    65,    66,    67,    43,    24,    25,    26,    27,    48,
-      71,    63,    64,    11,    28,    24,    25,    26,    27,    88,
-      89,    90,    86,    87,    28,    49,     4,    78,    79,    29,
-      50,    30,    54,    11,     5,    95,    70,    96,     6,    29,
-      72,    30,    76,    75,     7,     8,     9,    10,    57,    58,
-      59,    60,    61,    62,    98,    80,    81,    82,    83,    84,
-      85,    91,    92,    63,    64,   100,    93,   102,   103,    94,
-      99,    69
-};
-
-static const yytype_int8 yycheck[] =
-{
-       8,     9,    10,    12,     8,    91,     0,    26,     3,    28,
-      13,    14,     9,    21,    22,    23,    11,   103,    36,    37,
-      15,    29,    30,     3,    27,    38,    21,    22,    23,    24,
-      38,    33,    34,    35,    38,     3,     4,     5,     6,    27,
-      48,    31,    32,    38,    12,     3,     4,     5,     6,    65,
-      66,    67,    63,    64,    12,    29,     3,    55,    56,    27,
-      28,    29,    25,    38,    11,    73,    28,    76,    15,    27,
-       3,    29,     7,    30,    21,    22,    23,    24,    16,    17,
-      18,    19,    20,    21,    92,    57,    58,    59,    60,    61,
-      62,    25,    13,    31,    32,    15,    28,    10,    25,    30,
-      96,    43
-};
-
-/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
-   state STATE-NUM.  */
-static const yytype_int8 yystos[] =
-{
-       0,    40,    41,     0,     3,    11,    15,    21,    22,    23,
-      24,    38,    42,    44,    45,    46,    47,    48,    49,    50,
-      51,    13,    14,    27,     3,     4,     5,     6,    12,    27,
-      29,    52,    53,    54,    55,    56,    57,    58,     9,     3,
-      52,    52,    52,    38,    41,    52,    52,    52,    27,    29,
-      28,    52,    59,    52,    25,    36,    37,    16,    17,    18,
-      19,    20,    21,    31,    32,    33,    34,    35,    52,    44,
-      28,    52,     3,    26,    28,    30,     7,    43,    54,    54,
-      55,    55,    55,    55,    55,    55,    56,    56,    57,    57,
-      57,    25,    13,    28,    30,    52,    41,    43,    52,    42,
-      15,     8,    10,    25,    43
-};
-
-/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
-static const yytype_int8 yyr1[] =
-{
-       0,    39,    40,    41,    41,    42,    42,    42,    43,    44,
-      44,    44,    44,    44,    44,    44,    45,    45,    45,    46,
-      47,    48,    49,    50,    50,    51,    52,    53,    53,    53,
-      54,    54,    54,    54,    54,    54,    54,    55,    55,    55,
-      56,    56,    56,    56,    57,    57,    57,    57,    57,    57,
-      57,    57,    58,    58,    59,    59
-};
-
-/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
-static const yytype_int8 yyr2[] =
-{
-       0,     2,     3,     0,     2,     1,     3,     2,     4,     1,
-       1,     1,     1,     1,     1,     1,     3,     3,     6,     2,
-       2,     2,     2,     5,     9,     4,     1,     3,     3,     1,
-       3,     3,     3,     3,     3,     3,     1,     3,     3,     1,
-       3,     3,     3,     1,     3,     1,     1,     1,     1,     4,
-       1,     4,     2,     3,     3,     1
-};
-
-
-enum { YYENOMEM = -2 };
-
-#define yyerrok         (yyerrstatus = 0)
-#define yyclearin       (yychar = YYEMPTY)
-
-#define YYACCEPT        goto yyacceptlab
-#define YYABORT         goto yyabortlab
-#define YYERROR         goto yyerrorlab
-#define YYNOMEM         goto yyexhaustedlab
-
-
-#define YYRECOVERING()  (!!yyerrstatus)
-
-#define YYBACKUP(Token, Value)                                    \
-  do                                                              \
-    if (yychar == YYEMPTY)                                        \
-      {                                                           \
-        yychar = (Token);                                         \
-        yylval = (Value);                                         \
-        YYPOPSTACK (yylen);                                       \
-        yystate = *yyssp;                                         \
-        goto yybackup;                                            \
-      }                                                           \
-    else                                                          \
-      {                                                           \
-        yyerror (YY_("syntax error: cannot back up")); \
-        YYERROR;                                                  \
-      }                                                           \
-  while (0)
-
-/* Backward compatibility with an undocumented macro.
-   Use YYerror or YYUNDEF. */
-#define YYERRCODE YYUNDEF
-
-
-/* Enable debugging if requested.  */
-#if YYDEBUG
-
-# ifndef YYFPRINTF
-#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
-#  define YYFPRINTF fprintf
-# endif
-
-# define YYDPRINTF(Args)                        \
-do {                                            \
-  if (yydebug)                                  \
-    YYFPRINTF Args;                             \
-} while (0)
-
-
-
-
-# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
-do {                                                                      \
-  if (yydebug)                                                            \
-    {                                                                     \
-      YYFPRINTF (stderr, "%s ", Title);                                   \
-      yy_symbol_print (stderr,                                            \
-                  Kind, Value); \
-      YYFPRINTF (stderr, "\n");                                           \
-    }                                                                     \
-} while (0)
-
-
-/*-----------------------------------.
-| Print this symbol's value on YYO.  |
-`-----------------------------------*/
-
-static void
-yy_symbol_value_print (FILE *yyo,
-                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
-{
-  FILE *yyoutput = yyo;
-  YY_USE (yyoutput);
-  if (!yyvaluep)
-    return;
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YY_USE (yykind);
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
-}
-
-
-/*---------------------------.
-| Print this symbol on YYO.  |
-`---------------------------*/
-
-static void
-yy_symbol_print (FILE *yyo,
-                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
-{
-  YYFPRINTF (yyo, "%s %s (",
-             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
-
-  yy_symbol_value_print (yyo, yykind, yyvaluep);
-  YYFPRINTF (yyo, ")");
-}
-
-/*------------------------------------------------------------------.
-| yy_stack_print -- Print the state stack from its BOTTOM up to its |
-| TOP (included).                                                   |
-`------------------------------------------------------------------*/
-
-static void
-yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
-{
-  YYFPRINTF (stderr, "Stack now");
-  for (; yybottom <= yytop; yybottom++)
-    {
-      int yybot = *yybottom;
-      YYFPRINTF (stderr, " %d", yybot);
-    }
-  YYFPRINTF (stderr, "\n");
-}
-
-# define YY_STACK_PRINT(Bottom, Top)                            \
-do {                                                            \
-  if (yydebug)                                                  \
-    yy_stack_print ((Bottom), (Top));                           \
-} while (0)
-
-
-/*------------------------------------------------.
-| Report that the YYRULE is going to be reduced.  |
-`------------------------------------------------*/
-
-static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
-                 int yyrule)
-{
-  int yylno = yyrline[yyrule];
-  int yynrhs = yyr2[yyrule];
-  int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
-             yyrule - 1, yylno);
-  /* The symbols being reduced.  */
-  for (yyi = 0; yyi < yynrhs; yyi++)
-    {
-      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr,
-                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
-                       &yyvsp[(yyi + 1) - (yynrhs)]);
-      YYFPRINTF (stderr, "\n");
-    }
-}
-
-# define YY_REDUCE_PRINT(Rule)          \
-do {                                    \
-  if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, Rule); \
-} while (0)
-
-/* Nonzero means print parse trace.  It is left uninitialized so that
-   multiple parsers can coexist.  */
-int yydebug;
-#else /* !YYDEBUG */
-# define YYDPRINTF(Args) ((void) 0)
-# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
-# define YY_STACK_PRINT(Bottom, Top)
-# define YY_REDUCE_PRINT(Rule)
-#endif /* !YYDEBUG */
-
-
-/* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef YYINITDEPTH
-# define YYINITDEPTH 200
-#endif
-
-/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
-   if the built-in stack extension method is used).
-
-   Do not make this value too large; the results are undefined if
-   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
-   evaluated with infinite-precision integer arithmetic.  */
-
-#ifndef YYMAXDEPTH
-# define YYMAXDEPTH 10000
-#endif
-
-
-/* Context of a parse error.  */
-typedef struct
-{
-  yy_state_t *yyssp;
-  yysymbol_kind_t yytoken;
-} yypcontext_t;
-
-/* Put in YYARG at most YYARGN of the expected tokens given the
-   current YYCTX, and return the number of tokens stored in YYARG.  If
-   YYARG is null, return the number of expected tokens (guaranteed to
-   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
-   Return 0 if there are more than YYARGN expected tokens, yet fill
-   YYARG up to YYARGN. */
-static int
-yypcontext_expected_tokens (const yypcontext_t *yyctx,
-                            yysymbol_kind_t yyarg[], int yyargn)
-{
-  /* Actual size of YYARG. */
-  int yycount = 0;
-  int yyn = yypact[+*yyctx->yyssp];
-  if (!yypact_value_is_default (yyn))
-    {
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-         YYCHECK.  In other words, skip the first -YYN actions for
-         this state because they are default actions.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yyx;
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
-            && !yytable_value_is_error (yytable[yyx + yyn]))
-          {
-            if (!yyarg)
-              ++yycount;
-            else if (yycount == yyargn)
-              return 0;
-            else
-              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
-          }
-    }
-  if (yyarg && yycount == 0 && 0 < yyargn)
-    yyarg[0] = YYSYMBOL_YYEMPTY;
-  return yycount;
-}
-
-
-
-
-#ifndef yystrlen
-# if defined __GLIBC__ && defined _STRING_H
-#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-# else
-/* Return the length of YYSTR.  */
-static YYPTRDIFF_T
-yystrlen (const char *yystr)
-{
-  YYPTRDIFF_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-# endif
-#endif
-
-#ifndef yystpcpy
-# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#  define yystpcpy stpcpy
-# else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-# endif
-#endif
-
-#ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYPTRDIFF_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYPTRDIFF_T yyn = 0;
-      char const *yyp = yystr;
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (yyres)
-    return yystpcpy (yyres, yystr) - yyres;
-  else
-    return yystrlen (yystr);
-}
-#endif
-
-
-static int
-yy_syntax_error_arguments (const yypcontext_t *yyctx,
-                           yysymbol_kind_t yyarg[], int yyargn)
-{
-  /* Actual size of YYARG. */
-  int yycount = 0;
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
-    {
-      int yyn;
-      if (yyarg)
-        yyarg[yycount] = yyctx->yytoken;
-      ++yycount;
-      yyn = yypcontext_expected_tokens (yyctx,
-                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
-      if (yyn == YYENOMEM)
-        return YYENOMEM;
-      else
-        yycount += yyn;
-    }
-  return yycount;
-}
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                const yypcontext_t *yyctx)
-{
-  enum { YYARGS_MAX = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  yysymbol_kind_t yyarg[YYARGS_MAX];
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
-  /* Actual size of YYARG. */
-  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
-  if (yycount == YYENOMEM)
-    return YYENOMEM;
-
-  switch (yycount)
-    {
-#define YYCASE_(N, S)                       \
-      case N:                               \
-        yyformat = S;                       \
-        break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-#undef YYCASE_
-    }
-
-  /* Compute error message size.  Don't count the "%s"s, but reserve
-     room for the terminator.  */
-  yysize = yystrlen (yyformat) - 2 * yycount + 1;
-  {
-    int yyi;
-    for (yyi = 0; yyi < yycount; ++yyi)
-      {
-        YYPTRDIFF_T yysize1
-          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
-        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-          yysize = yysize1;
-        else
-          return YYENOMEM;
-      }
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return -1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
-          yyformat += 2;
-        }
-      else
-        {
-          ++yyp;
-          ++yyformat;
-        }
-  }
-  return 0;
-}
-
-
-/*-----------------------------------------------.
-| Release the memory associated to this symbol.  |
-`-----------------------------------------------*/
-
-static void
-yydestruct (const char *yymsg,
-            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
-{
-  YY_USE (yyvaluep);
-  if (!yymsg)
-    yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
-
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YY_USE (yykind);
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
-}
-
-
-/* Lookahead token kind.  */
-int yychar;
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Number of syntax errors so far.  */
-int yynerrs;
-
-
-
-
-/*----------.
-| yyparse.  |
-`----------*/
-
-int
-yyparse (void)
-{
-    yy_state_fast_t yystate = 0;
-    /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus = 0;
-
-    /* Refer to the stacks through separate pointers, to allow yyoverflow
-       to reallocate them elsewhere.  */
-
-    /* Their size.  */
-    YYPTRDIFF_T yystacksize = YYINITDEPTH;
-
-    /* The state stack: array, bottom, top.  */
-    yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss = yyssa;
-    yy_state_t *yyssp = yyss;
-
-    /* The semantic value stack: array, bottom, top.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs = yyvsa;
-    YYSTYPE *yyvsp = yyvs;
-
-  int yyn;
-  /* The return value of yyparse.  */
-  int yyresult;
-  /* Lookahead symbol kind.  */
-  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
-  /* The variables used to return semantic value and location from the
-     action routines.  */
-  YYSTYPE yyval;
-
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
-
-  /* The number of symbols on the RHS of the reduced rule.
-     Keep to zero when no symbol should be popped.  */
-  int yylen = 0;
-
-  YYDPRINTF ((stderr, "Starting parse\n"));
-
-  yychar = YYEMPTY; /* Cause a token to be read.  */
-
-  goto yysetstate;
-
-
-/*------------------------------------------------------------.
-| yynewstate -- push a new state, which is found in yystate.  |
-`------------------------------------------------------------*/
-yynewstate:
-  /* In all cases, when you get here, the value and location stacks
-     have just been pushed.  So pushing a state here evens the stacks.  */
-  yyssp++;
-
-
-/*--------------------------------------------------------------------.
-| yysetstate -- set current state (the top of the stack) to yystate.  |
-`--------------------------------------------------------------------*/
-yysetstate:
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
-  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
-  YY_IGNORE_USELESS_CAST_BEGIN
-  *yyssp = YY_CAST (yy_state_t, yystate);
-  YY_IGNORE_USELESS_CAST_END
-  YY_STACK_PRINT (yyss, yyssp);
-
-  if (yyss + yystacksize - 1 <= yyssp)
-#if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    YYNOMEM;
-#else
-    {
-      /* Get the current used size of the three stacks, in elements.  */
-      YYPTRDIFF_T yysize = yyssp - yyss + 1;
-
-# if defined yyoverflow
-      {
-        /* Give user a chance to reallocate the stack.  Use copies of
-           these so that the &'s don't force the real ones into
-           memory.  */
-        yy_state_t *yyss1 = yyss;
-        YYSTYPE *yyvs1 = yyvs;
-
-        /* Each stack pointer address is followed by the size of the
-           data in use in that stack, in bytes.  This used to be a
-           conditional around just the two extra args, but that might
-           be undefined if yyoverflow is a macro.  */
-        yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * YYSIZEOF (*yyssp),
-                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
-                    &yystacksize);
-        yyss = yyss1;
-        yyvs = yyvs1;
-      }
-# else /* defined YYSTACK_RELOCATE */
-      /* Extend the stack our own way.  */
-      if (YYMAXDEPTH <= yystacksize)
-        YYNOMEM;
-      yystacksize *= 2;
-      if (YYMAXDEPTH < yystacksize)
-        yystacksize = YYMAXDEPTH;
-
-      {
-        yy_state_t *yyss1 = yyss;
-        union yyalloc *yyptr =
-          YY_CAST (union yyalloc *,
-                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
-        if (! yyptr)
-          YYNOMEM;
-        YYSTACK_RELOCATE (yyss_alloc, yyss);
-        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-#  undef YYSTACK_RELOCATE
-        if (yyss1 != yyssa)
-          YYSTACK_FREE (yyss1);
-      }
-# endif
-
-      yyssp = yyss + yysize - 1;
-      yyvsp = yyvs + yysize - 1;
-
-      YY_IGNORE_USELESS_CAST_BEGIN
-      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
-                  YY_CAST (long, yystacksize)));
-      YY_IGNORE_USELESS_CAST_END
-
-      if (yyss + yystacksize - 1 <= yyssp)
-        YYABORT;
-    }
-#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
-
-
-  if (yystate == YYFINAL)
-    YYACCEPT;
-
-  goto yybackup;
-
-
-/*-----------.
-| yybackup.  |
-`-----------*/
-yybackup:
-  /* Do appropriate processing given the current state.  Read a
-     lookahead token if we need one and don't already have one.  */
-
-  /* First try to decide what to do without reference to lookahead token.  */
-  yyn = yypact[yystate];
-  if (yypact_value_is_default (yyn))
-    goto yydefault;
-
-  /* Not known => get a lookahead token if don't already have one.  */
-
-  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
-  if (yychar == YYEMPTY)
-    {
-      YYDPRINTF ((stderr, "Reading a token\n"));
-      yychar = yylex ();
-    }
-
-  if (yychar <= YYEOF)
-    {
-      yychar = YYEOF;
-      yytoken = YYSYMBOL_YYEOF;
-      YYDPRINTF ((stderr, "Now at end of input.\n"));
-    }
-  else if (yychar == YYerror)
-    {
-      /* The scanner already issued an error message, process directly
-         to error recovery.  But do not keep the error token as
-         lookahead, it is too special and may lead us to an endless
-         loop in error recovery. */
-      yychar = YYUNDEF;
-      yytoken = YYSYMBOL_YYerror;
-      goto yyerrlab1;
-    }
-  else
-    {
-      yytoken = YYTRANSLATE (yychar);
-      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
-    }
-
-  /* If the proper action on seeing token YYTOKEN is to reduce or to
-     detect an error, take that action.  */
-  yyn += yytoken;
-  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
-    goto yydefault;
-  yyn = yytable[yyn];
-  if (yyn <= 0)
-    {
-      if (yytable_value_is_error (yyn))
-        goto yyerrlab;
-      yyn = -yyn;
-      goto yyreduce;
-    }
-
-  /* Count tokens shifted since error; after three, turn off error
-     status.  */
-  if (yyerrstatus)
-    yyerrstatus--;
-
-  /* Shift the lookahead token.  */
-  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-  yystate = yyn;
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  *++yyvsp = yylval;
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-  goto yynewstate;
-
-
-/*-----------------------------------------------------------.
-| yydefault -- do the default action for the current state.  |
-`-----------------------------------------------------------*/
-yydefault:
-  yyn = yydefact[yystate];
-  if (yyn == 0)
-    goto yyerrlab;
-  goto yyreduce;
-
-
-/*-----------------------------.
-| yyreduce -- do a reduction.  |
-`-----------------------------*/
-yyreduce:
-  /* yyn is the number of a rule to reduce with.  */
-  yylen = yyr2[yyn];
-
-  /* If YYLEN is nonzero, implement the default value of the action:
-     '$$ = $1'.
-
-     Otherwise, the following line sets YYVAL to garbage.
-     This behavior is undocumented and Bison
-     users should not rely upon it.  Assigning to YYVAL
-     unconditionally makes the parser a bit smaller, and it avoids a
-     GCC warning that YYVAL may be used uninitialized.  */
-  yyval = yyvsp[1-yylen];
-
-
-  YY_REDUCE_PRINT (yyn);
-  switch (yyn)
-    {
-  case 2: /* program: opt_newlines statements opt_newlines  */
-#line 56 "parser.y"
-                                         { rootBlock = (yyvsp[-1].block); }
-#line 1473 "parser.tab.c"
-    break;
-
-  case 5: /* statements: statement  */
-#line 66 "parser.y"
-                                              { (yyval.block) = new Block(); (yyval.block)->add((yyvsp[0].node)); }
-#line 1479 "parser.tab.c"
-    break;
-
-  case 6: /* statements: statements NEWLINE statement  */
-#line 67 "parser.y"
-                                              { (yyval.block) = (yyvsp[-2].block); (yyval.block)->add((yyvsp[0].node)); }
-#line 1485 "parser.tab.c"
-    break;
-
-  case 7: /* statements: statements NEWLINE  */
-#line 68 "parser.y"
-                                              { (yyval.block) = (yyvsp[-1].block); /* linha em branco */ }
-#line 1491 "parser.tab.c"
-    break;
-
-  case 8: /* block: TOKEN_INDENT opt_newlines statements TOKEN_DEDENT  */
-#line 72 "parser.y"
-                                                      { (yyval.block) = (yyvsp[-1].block); }
-#line 1497 "parser.tab.c"
-    break;
-
-  case 9: /* statement: assignment  */
-#line 76 "parser.y"
-                    { (yyval.node) = (yyvsp[0].node); }
-#line 1503 "parser.tab.c"
-    break;
-
-  case 10: /* statement: question  */
-#line 77 "parser.y"
-                    { (yyval.node) = (yyvsp[0].node); }
-#line 1509 "parser.tab.c"
-    break;
-
-  case 11: /* statement: input_ans  */
-#line 78 "parser.y"
-                    { (yyval.node) = (yyvsp[0].node); }
-#line 1515 "parser.tab.c"
-    break;
-
-  case 12: /* statement: output  */
-#line 79 "parser.y"
-                    { (yyval.node) = (yyvsp[0].node); }
-#line 1521 "parser.tab.c"
-    break;
-
-  case 13: /* statement: conclusion  */
-#line 80 "parser.y"
-                    { (yyval.node) = (yyvsp[0].node); }
-#line 1527 "parser.tab.c"
-    break;
-
-  case 14: /* statement: conditional  */
-#line 81 "parser.y"
-                    { (yyval.node) = (yyvsp[0].node); }
-#line 1533 "parser.tab.c"
-    break;
-
-  case 15: /* statement: loop  */
-#line 82 "parser.y"
-                    { (yyval.node) = (yyvsp[0].node); }
-#line 1539 "parser.tab.c"
-    break;
-
-  case 16: /* assignment: VAR_ID OP_ASSIGN expression  */
-#line 86 "parser.y"
-                                                        { (yyval.node) = new Assignment(*(yyvsp[-2].sVal), (yyvsp[0].expr)); delete (yyvsp[-2].sVal); }
-#line 1545 "parser.tab.c"
-    break;
-
-  case 17: /* assignment: VAR_ID OP_APPEND expression  */
-#line 87 "parser.y"
-                                                        { (yyval.node) = new Assignment(*(yyvsp[-2].sVal), (yyvsp[0].expr), true); delete (yyvsp[-2].sVal); }
-#line 1551 "parser.tab.c"
-    break;
-
-  case 18: /* assignment: VAR_ID LBRACKET expression RBRACKET OP_ASSIGN expression  */
-#line 89 "parser.y"
-                                                        { (yyval.node) = new Assignment(*(yyvsp[-5].sVal), (yyvsp[-3].expr), (yyvsp[0].expr)); delete (yyvsp[-5].sVal); }
-#line 1557 "parser.tab.c"
-    break;
-
-  case 19: /* question: OP_QUEST expression  */
-#line 93 "parser.y"
-                        { (yyval.node) = new Question((yyvsp[0].expr)); }
-#line 1563 "parser.tab.c"
-    break;
-
-  case 20: /* input_ans: OP_GT VAR_ID  */
-#line 97 "parser.y"
-                 { (yyval.node) = new InputAnswer(*(yyvsp[0].sVal)); delete (yyvsp[0].sVal); }
-#line 1569 "parser.tab.c"
-    break;
-
-  case 21: /* output: OP_LOG expression  */
-#line 101 "parser.y"
-                      { (yyval.node) = new Output(">>", (yyvsp[0].expr)); }
-#line 1575 "parser.tab.c"
-    break;
-
-  case 22: /* conclusion: OP_CONCL expression  */
-#line 105 "parser.y"
-                        { (yyval.node) = new Output("!", (yyvsp[0].expr)); }
-#line 1581 "parser.tab.c"
-    break;
-
-  case 23: /* conditional: OP_ARROW KW_SE expression COLON block  */
-#line 110 "parser.y"
-        { (yyval.node) = new IfStmt((yyvsp[-2].expr), (yyvsp[0].block)); }
-#line 1587 "parser.tab.c"
-    break;
-
-  case 24: /* conditional: OP_ARROW KW_SE expression COLON block OP_ARROW KW_SENAO COLON block  */
-#line 112 "parser.y"
-        { (yyval.node) = new IfStmt((yyvsp[-6].expr), (yyvsp[-4].block), (yyvsp[0].block)); }
-#line 1593 "parser.tab.c"
-    break;
-
-  case 25: /* loop: KW_ENQUANTO expression COLON block  */
-#line 116 "parser.y"
-                                       { (yyval.node) = new WhileStmt((yyvsp[-2].expr), (yyvsp[0].block)); }
-#line 1599 "parser.tab.c"
-    break;
-
-  case 26: /* expression: logic_expr  */
-#line 120 "parser.y"
-               { (yyval.expr) = (yyvsp[0].expr); }
-#line 1605 "parser.tab.c"
-    break;
-
-  case 27: /* logic_expr: logic_expr OP_AND comp_expr  */
-#line 124 "parser.y"
-                                  { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "AND", (yyvsp[0].expr)); }
-#line 1611 "parser.tab.c"
-    break;
-
-  case 28: /* logic_expr: logic_expr OP_OR comp_expr  */
-#line 125 "parser.y"
-                                  { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "OR",  (yyvsp[0].expr)); }
-#line 1617 "parser.tab.c"
-    break;
-
-  case 29: /* logic_expr: comp_expr  */
-#line 126 "parser.y"
-                                { (yyval.expr) = (yyvsp[0].expr); }
-#line 1623 "parser.tab.c"
-    break;
-
-  case 30: /* comp_expr: math_expr OP_EQ math_expr  */
-#line 130 "parser.y"
-                                 { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "==", (yyvsp[0].expr)); }
-#line 1629 "parser.tab.c"
-    break;
-
-  case 31: /* comp_expr: math_expr OP_NEQ math_expr  */
-#line 131 "parser.y"
-                                 { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "!=", (yyvsp[0].expr)); }
-#line 1635 "parser.tab.c"
-    break;
-
-  case 32: /* comp_expr: math_expr OP_LT math_expr  */
-#line 132 "parser.y"
-                                 { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "<",  (yyvsp[0].expr)); }
-#line 1641 "parser.tab.c"
-    break;
-
-  case 33: /* comp_expr: math_expr OP_LTE math_expr  */
-#line 133 "parser.y"
-                                 { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "<=", (yyvsp[0].expr)); }
-#line 1647 "parser.tab.c"
-    break;
-
-  case 34: /* comp_expr: math_expr OP_GT math_expr  */
-#line 134 "parser.y"
-                                 { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), ">",  (yyvsp[0].expr)); }
-#line 1653 "parser.tab.c"
-    break;
-
-  case 35: /* comp_expr: math_expr OP_GTE math_expr  */
-#line 135 "parser.y"
-                                 { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), ">=", (yyvsp[0].expr)); }
-#line 1659 "parser.tab.c"
-    break;
-
-  case 36: /* comp_expr: math_expr  */
-#line 136 "parser.y"
-                                { (yyval.expr) = (yyvsp[0].expr); }
-#line 1665 "parser.tab.c"
-    break;
-
-  case 37: /* math_expr: math_expr PLUS term  */
-#line 140 "parser.y"
-                           { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "+", (yyvsp[0].expr)); }
-#line 1671 "parser.tab.c"
-    break;
-
-  case 38: /* math_expr: math_expr MINUS term  */
-#line 141 "parser.y"
-                           { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "-", (yyvsp[0].expr)); }
-#line 1677 "parser.tab.c"
-    break;
-
-  case 39: /* math_expr: term  */
-#line 142 "parser.y"
-                           { (yyval.expr) = (yyvsp[0].expr); }
-#line 1683 "parser.tab.c"
-    break;
-
-  case 40: /* term: term MULT factor  */
-#line 146 "parser.y"
-                       { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "*", (yyvsp[0].expr)); }
-#line 1689 "parser.tab.c"
-    break;
-
-  case 41: /* term: term DIV factor  */
-#line 147 "parser.y"
-                       { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "/", (yyvsp[0].expr)); }
-#line 1695 "parser.tab.c"
-    break;
-
-  case 42: /* term: term MOD factor  */
-#line 148 "parser.y"
-                       { (yyval.expr) = new BinaryOp((yyvsp[-2].expr), "%", (yyvsp[0].expr)); }
-#line 1701 "parser.tab.c"
-    break;
-
-  case 43: /* term: factor  */
-#line 149 "parser.y"
-                       { (yyval.expr) = (yyvsp[0].expr); }
-#line 1707 "parser.tab.c"
-    break;
-
-  case 44: /* factor: LPAREN expression RPAREN  */
-#line 153 "parser.y"
-                                             { (yyval.expr) = (yyvsp[-1].expr); }
-#line 1713 "parser.tab.c"
-    break;
-
-  case 45: /* factor: LIT_NUMBER  */
-#line 154 "parser.y"
-                                             { (yyval.expr) = new Literal(Value((yyvsp[0].dVal))); }
-#line 1719 "parser.tab.c"
-    break;
-
-  case 46: /* factor: LIT_STRING  */
-#line 155 "parser.y"
-                                             { (yyval.expr) = new Literal(Value(*(yyvsp[0].sVal))); delete (yyvsp[0].sVal); }
-#line 1725 "parser.tab.c"
-    break;
-
-  case 47: /* factor: LIT_BOOL  */
-#line 156 "parser.y"
-                                             { (yyval.expr) = new Literal(Value((yyvsp[0].bVal))); }
-#line 1731 "parser.tab.c"
-    break;
-
-  case 48: /* factor: VAR_ID  */
-#line 157 "parser.y"
-                                             { (yyval.expr) = new Variable(*(yyvsp[0].sVal)); delete (yyvsp[0].sVal); }
-#line 1737 "parser.tab.c"
-    break;
-
-  case 49: /* factor: VAR_ID LBRACKET expression RBRACKET  */
-#line 158 "parser.y"
-                                             { (yyval.expr) = new ListAccess(*(yyvsp[-3].sVal), (yyvsp[-1].expr)); delete (yyvsp[-3].sVal); }
-#line 1743 "parser.tab.c"
-    break;
-
-  case 50: /* factor: list_def  */
-#line 159 "parser.y"
-                                             { (yyval.expr) = (yyvsp[0].listLit); }
-#line 1749 "parser.tab.c"
-    break;
-
-  case 51: /* factor: KW_TAMANHO LPAREN VAR_ID RPAREN  */
-#line 160 "parser.y"
-                                             { (yyval.expr) = new LengthFunc(new Variable(*(yyvsp[-1].sVal))); delete (yyvsp[-1].sVal); }
-#line 1755 "parser.tab.c"
-    break;
-
-  case 52: /* list_def: LBRACKET RBRACKET  */
-#line 164 "parser.y"
-                                     { (yyval.listLit) = new ListLiteral(); }
-#line 1761 "parser.tab.c"
-    break;
-
-  case 53: /* list_def: LBRACKET list_items RBRACKET  */
-#line 165 "parser.y"
-                                     { (yyval.listLit) = (yyvsp[-1].listLit); }
-#line 1767 "parser.tab.c"
-    break;
-
-  case 54: /* list_items: list_items COMMA expression  */
-#line 169 "parser.y"
-                                  { (yyval.listLit) = (yyvsp[-2].listLit); (yyval.listLit)->add((yyvsp[0].expr)); }
-#line 1773 "parser.tab.c"
-    break;
-
-  case 55: /* list_items: expression  */
-#line 170 "parser.y"
-                                  { (yyval.listLit) = new ListLiteral(); (yyval.listLit)->add((yyvsp[0].expr)); }
-#line 1779 "parser.tab.c"
-    break;
-
-
-#line 1783 "parser.tab.c"
-
-      default: break;
-    }
-  /* User semantic actions sometimes alter yychar, and that requires
-     that yytoken be updated with the new translation.  We take the
-     approach of translating immediately before every use of yytoken.
-     One alternative is translating here after every semantic action,
-     but that translation would be missed if the semantic action invokes
-     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
-     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
-     incorrect destructor might then be invoked immediately.  In the
-     case of YYERROR or YYBACKUP, subsequent parser actions might lead
-     to an incorrect destructor call or verbose syntax error message
-     before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
-
-  YYPOPSTACK (yylen);
-  yylen = 0;
-
-  *++yyvsp = yyval;
-
-  /* Now 'shift' the result of the reduction.  Determine what state
-     that goes to, based on the state we popped back to and the rule
-     number reduced by.  */
-  {
-    const int yylhs = yyr1[yyn] - YYNTOKENS;
-    const int yyi = yypgoto[yylhs] + *yyssp;
-    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
-               ? yytable[yyi]
-               : yydefgoto[yylhs]);
-  }
-
-  goto yynewstate;
-
-
-/*--------------------------------------.
-| yyerrlab -- here on detecting error.  |
-`--------------------------------------*/
-yyerrlab:
-  /* Make sure we have latest lookahead translation.  See comments at
-     user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
-  /* If not already recovering from an error, report this error.  */
-  if (!yyerrstatus)
-    {
-      ++yynerrs;
-      {
-        yypcontext_t yyctx
-          = {yyssp, yytoken};
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == -1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *,
-                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (yymsg)
-              {
-                yysyntax_error_status
-                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
-                yymsgp = yymsg;
-              }
-            else
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = YYENOMEM;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == YYENOMEM)
-          YYNOMEM;
-      }
-    }
-
-  if (yyerrstatus == 3)
-    {
-      /* If just tried and failed to reuse lookahead token after an
-         error, discard it.  */
-
-      if (yychar <= YYEOF)
-        {
-          /* Return failure if at end of input.  */
-          if (yychar == YYEOF)
-            YYABORT;
-        }
-      else
-        {
-          yydestruct ("Error: discarding",
-                      yytoken, &yylval);
-          yychar = YYEMPTY;
-        }
-    }
-
-  /* Else will try to reuse lookahead token after shifting the error
-     token.  */
-  goto yyerrlab1;
-
-
-/*---------------------------------------------------.
-| yyerrorlab -- error raised explicitly by YYERROR.  |
-`---------------------------------------------------*/
-yyerrorlab:
-  /* Pacify compilers when the user code never invokes YYERROR and the
-     label yyerrorlab therefore never appears in user code.  */
-  if (0)
-    YYERROR;
-  ++yynerrs;
-
-  /* Do not reclaim the symbols of the rule whose action triggered
-     this YYERROR.  */
-  YYPOPSTACK (yylen);
-  yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
-  yystate = *yyssp;
-  goto yyerrlab1;
-
-
-/*-------------------------------------------------------------.
-| yyerrlab1 -- common code for both syntax error and YYERROR.  |
-`-------------------------------------------------------------*/
-yyerrlab1:
-  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
-
-  /* Pop stack until we find a state that shifts the error token.  */
-  for (;;)
-    {
-      yyn = yypact[yystate];
-      if (!yypact_value_is_default (yyn))
-        {
-          yyn += YYSYMBOL_YYerror;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
-            {
-              yyn = yytable[yyn];
-              if (0 < yyn)
-                break;
-            }
-        }
-
-      /* Pop the current state because it cannot handle the error token.  */
-      if (yyssp == yyss)
-        YYABORT;
-
-
-      yydestruct ("Error: popping",
-                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
-      YYPOPSTACK (1);
-      yystate = *yyssp;
-      YY_STACK_PRINT (yyss, yyssp);
-    }
-
-  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  *++yyvsp = yylval;
-  YY_IGNORE_MAYBE_UNINITIALIZED_END
-
-
-  /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
-
-  yystate = yyn;
-  goto yynewstate;
-
-
-/*-------------------------------------.
-| yyacceptlab -- YYACCEPT comes here.  |
-`-------------------------------------*/
-yyacceptlab:
-  yyresult = 0;
-  goto yyreturnlab;
-
-
-/*-----------------------------------.
-| yyabortlab -- YYABORT comes here.  |
-`-----------------------------------*/
-yyabortlab:
-  yyresult = 1;
-  goto yyreturnlab;
-
-
-/*-----------------------------------------------------------.
-| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
-`-----------------------------------------------------------*/
-yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
-  yyresult = 2;
-  goto yyreturnlab;
-
-
-/*----------------------------------------------------------.
-| yyreturnlab -- parsing is finished, clean up and return.  |
-`----------------------------------------------------------*/
-yyreturnlab:
-  if (yychar != YYEMPTY)
-    {
-      /* Make sure we have latest lookahead translation.  See comments at
-         user semantic actions for why this is necessary.  */
-      yytoken = YYTRANSLATE (yychar);
-      yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
-    }
-  /* Do not reclaim the symbols of the rule whose action triggered
-     this YYABORT or YYACCEPT.  */
-  YYPOPSTACK (yylen);
-  YY_STACK_PRINT (yyss, yyssp);
-  while (yyssp != yyss)
-    {
-      yydestruct ("Cleanup: popping",
-                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
-      YYPOPSTACK (1);
-    }
-#ifndef yyoverflow
-  if (yyss != yyssa)
-    YYSTACK_FREE (yyss);
-#endif
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-  return yyresult;
-}
-
-#line 173 "parser.y"
-
-
-void yyerror(const char *s) {
-    std::cerr << "Erro de Sintaxe: " << s << " na linha " << yylineno << std::endl;
-}
-
-int main(int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Uso: " << argv[0] << " fonte.ms [saida.asm]" << std::endl;
-        return 1;
-    }
-
-    std::string inputFile  = argv[1];
-    std::string outputFile;
-
-    // Se o usuário passar o .asm explicitamente, usa. Senão, troca a extensão.
-    if (argc >= 3) {
-        outputFile = argv[2];
-    } else {
-        outputFile = inputFile;
-        size_t dot = outputFile.find_last_of('.');
-        if (dot != std::string::npos) {
-            outputFile = outputFile.substr(0, dot);
-        }
-        outputFile += ".asm";
-    }
-
-    FILE *file = fopen(inputFile.c_str(), "r");
-    if (!file) {
-        std::cerr << "Erro ao abrir o arquivo: " << inputFile << std::endl;
-        return 1;
-    }
-    yyin = file;
-
-    if (indent_stack.empty()) indent_stack.push(0);
-
-    // Agora: COMPILA para .asm em vez de executar a AST
-    if (yyparse() == 0 && rootBlock != nullptr) {
-        std::ofstream out(outputFile);
-        if (!out) {
-            std::cerr << "Erro ao criar arquivo de saída: " << outputFile << std::endl;
-            fclose(file);
-            return 1;
-        }
-
-        out << "; Arquivo gerado pelo compilador Maiêutic\n";
-        out << "; Fonte: " << inputFile << "\n\n";
-
-        rootBlock->generate(out);
-
-        out << "\nHALT\n";
-
-        std::cout << "Assembly gerado em: " << outputFile << std::endl;
-    } else {
-        std::cerr << "Erro de sintaxe. Assembly não gerado." << std::endl;
-    }
-
-    fclose(file);
-    return 0;
-}
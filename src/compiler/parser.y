@@ -2,37 +2,68 @@
 #include <iostream>
 #include <vector>
 #include <string>
-#include <stack>
 #include <cstdio>
-#include <fstream>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <new>
+#include <thread>
 #include "ast.h"
+#include "source.h"
+#include "incremental.h"
+#include "server.h"
+#include "linker.h"
+#include "stackdepth.h"
+#include "passes.h"
+%}
 
-extern int yylex();
-extern int yylineno;
-extern FILE* yyin;
-extern std::stack<int> indent_stack; 
-void yyerror(const char *s);
+/* Parser puro: sem yylval/yylineno globais. O estado da compilação vem no
+   CompileContext e o do lexer no yyscan_t, ambos passados ao yyparse. */
+%code requires {
+struct CompileContext;
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+}
 
-Block* rootBlock = nullptr;
-%}
+%code {
+int yylex(YYSTYPE* yylval, yyscan_t scanner);
+int yylex_init_extra(CompileContext* extra, yyscan_t* scanner);
+int yylex_destroy(yyscan_t scanner);
+struct yy_buffer_state* yy_scan_buffer(char* base, size_t size, yyscan_t scanner);
+void yy_delete_buffer(struct yy_buffer_state* buffer, yyscan_t scanner);
+int yyget_lineno(yyscan_t scanner);
+void yyset_lineno(int line, yyscan_t scanner);
+void yyerror(CompileContext& context, yyscan_t scanner, const char* s);
+}
+
+%define api.pure full
+%parse-param { CompileContext& context } { yyscan_t scanner }
+%lex-param { yyscan_t scanner }
 
 %define parse.error verbose
 
 %union {
+    int line;
     double dVal;
     bool bVal;
-    std::string* sVal;
+    Symbol symbol;
+    TokenText text;
     Node* node;
     Expression* expr;
     Block* block;
     ListLiteral* listLit;
 }
 
-%token <sVal> VAR_ID LIT_STRING
+%token <symbol> VAR_ID
+%token <text> LIT_STRING
 %token <dVal> LIT_NUMBER
 %token <bVal> LIT_BOOL
 %token TOKEN_INDENT TOKEN_DEDENT
-%token KW_SE KW_SENAO KW_ENQUANTO KW_TAMANHO
+%token KW_SE KW_SENAO KW_ENQUANTO KW_TAMANHO KW_IMPORTAR
 %token OP_ASSIGN OP_APPEND OP_ARROW OP_EQ OP_NEQ OP_GTE OP_LTE OP_LT OP_GT
 %token OP_LOG OP_QUEST OP_CONCL
 %token COLON COMMA LBRACKET RBRACKET LPAREN RPAREN
@@ -42,7 +73,8 @@ Block* rootBlock = nullptr;
 %type <expr> expression logic_expr comp_expr math_expr term factor
 %type <listLit> list_def list_items 
 %type <block> program block statements
-%type <node> statement assignment conditional loop question input_ans output conclusion
+%type <node> statement command assignment conditional loop question input_ans output conclusion import
+%type <line> line_mark
 
 %left OP_OR
 %left OP_AND
@@ -53,7 +85,7 @@ Block* rootBlock = nullptr;
 %%
 
 program:
-    opt_newlines statements opt_newlines { rootBlock = $2; }
+    opt_newlines statements opt_newlines { context.root = $2; }
     ;
 
 opt_newlines:
@@ -72,7 +104,17 @@ block:
     TOKEN_INDENT opt_newlines statements TOKEN_DEDENT { $$ = $3; }
     ;
 
+/* A linha do comando é a do seu primeiro token: line_mark é reduzido com
+   ele já lido como lookahead */
 statement:
+    line_mark command { $$ = $2; $$->line = $1; }
+    ;
+
+line_mark:
+    /* vazio */ { $$ = yyget_lineno(scanner); }
+    ;
+
+command:
       assignment    { $$ = $1; }
     | question      { $$ = $1; }
     | input_ans     { $$ = $1; }
@@ -80,13 +122,14 @@ statement:
     | conclusion    { $$ = $1; }
     | conditional   { $$ = $1; }
     | loop          { $$ = $1; }
+    | import        { $$ = $1; }
     ;
 
 assignment:
-      VAR_ID OP_ASSIGN expression                       { $$ = new Assignment(*$1, $3); delete $1; }
-    | VAR_ID OP_APPEND expression                       { $$ = new Assignment(*$1, $3, true); delete $1; }
+      VAR_ID OP_ASSIGN expression                       { $$ = new Assignment($1, $3); }
+    | VAR_ID OP_APPEND expression                       { $$ = new Assignment($1, $3, true); }
     | VAR_ID LBRACKET expression RBRACKET OP_ASSIGN expression
-                                                        { $$ = new Assignment(*$1, $3, $6); delete $1; }
+                                                        { $$ = new Assignment($1, $3, $6); }
     ;
 
 question:
@@ -94,7 +137,7 @@ question:
     ;
 
 input_ans:
-    OP_GT VAR_ID { $$ = new InputAnswer(*$2); delete $2; }
+    OP_GT VAR_ID { $$ = new InputAnswer($2); }
     ;
 
 output:
@@ -116,6 +159,10 @@ loop:
     KW_ENQUANTO expression COLON block { $$ = new WhileStmt($2, $4); }
     ;
 
+import:
+    KW_IMPORTAR LIT_STRING { $$ = new ImportStmt(std::string($2.view())); }
+    ;
+
 expression:
     logic_expr { $$ = $1; }
     ;
@@ -152,12 +199,12 @@ term:
 factor:
       LPAREN expression RPAREN               { $$ = $2; }
     | LIT_NUMBER                             { $$ = new Literal(Value($1)); }
-    | LIT_STRING                             { $$ = new Literal(Value(*$1)); delete $1; }
+    | LIT_STRING                             { $$ = new Literal(Value(std::string($1.view()))); }
     | LIT_BOOL                               { $$ = new Literal(Value($1)); }
-    | VAR_ID                                 { $$ = new Variable(*$1); delete $1; }
-    | VAR_ID LBRACKET expression RBRACKET    { $$ = new ListAccess(*$1, $3); delete $1; }
+    | VAR_ID                                 { $$ = new Variable($1); }
+    | VAR_ID LBRACKET expression RBRACKET    { $$ = new ListAccess($1, $3); }
     | list_def                               { $$ = $1; }
-    | KW_TAMANHO LPAREN VAR_ID RPAREN        { $$ = new LengthFunc(new Variable(*$3)); delete $3; }
+    | KW_TAMANHO LPAREN VAR_ID RPAREN        { $$ = new LengthFunc(new Variable($3)); }
     ;
 
 list_def:
@@ -172,61 +219,713 @@ list_items:
 
 %%
 
-void yyerror(const char *s) {
-    std::cerr << "Erro de Sintaxe: " << s << " na linha " << yylineno << std::endl;
+void yyerror(CompileContext& context, yyscan_t scanner, const char *s) {
+    context.diagnostics += "Erro de Sintaxe: " + std::string(s) + " na linha "
+                         + std::to_string(yyget_lineno(scanner)) + "\n";
 }
 
-int main(int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Uso: " << argv[0] << " fonte.ms [saida.asm]" << std::endl;
-        return 1;
+// Analisa um buffer no formato do yy_scan_buffer (texto seguido de dois
+// bytes 0) para context.root, com um scanner próprio: compilações em threads
+// diferentes não compartilham nenhum estado. O scanner lê o buffer no lugar,
+// sem copiá-lo para os buffers do flex. `firstLine` é o número da primeira
+// linha do buffer nas mensagens de erro (no parse incremental, um trecho do
+// meio do fonte).
+bool parseBuffer(CompileContext& context, char* data, size_t size, int firstLine) {
+    CompileContext::Scope scope(context);
+    context.root = nullptr;
+    context.indentStack.assign(1, 0);
+    yyscan_t scanner;
+    if (yylex_init_extra(&context, &scanner) != 0) return false;
+    struct yy_buffer_state* buffer = yy_scan_buffer(data, size, scanner);
+    bool parsed = false;
+    if (buffer) {
+        // o yy_scan_buffer não inicia a contagem de linhas do buffer novo
+        yyset_lineno(firstLine, scanner);
+        parsed = yyparse(context, scanner) == 0 && context.root != nullptr;
+        yy_delete_buffer(buffer, scanner);
+    }
+    yylex_destroy(scanner);
+    return parsed;
+}
+
+bool parseProgram(CompileContext& context, SourceFile& source) {
+    return parseBuffer(context, source.data(), source.bufferSize(), 1);
+}
+
+// --time-passes: varre o buffer só com o lexer, num contexto descartável,
+// para medir o léxico à parte do parser. Devolve quantos tokens leu.
+size_t lexBuffer(CompileContext& context, char* data, size_t size) {
+    CompileContext::Scope scope(context);
+    context.indentStack.assign(1, 0);
+    yyscan_t scanner;
+    if (yylex_init_extra(&context, &scanner) != 0) return 0;
+    size_t tokens = 0;
+    if (struct yy_buffer_state* buffer = yy_scan_buffer(data, size, scanner)) {
+        YYSTYPE value;
+        while (yylex(&value, scanner) != 0) ++tokens;
+        yy_delete_buffer(buffer, scanner);
+    }
+    yylex_destroy(scanner);
+    return tokens;
+}
+
+// Um arquivo a compilar: da linha de comando ou, com -j, de uma lista
+struct CompileJob {
+    std::string input;
+    std::string output;
+    size_t bytes = 0;      // tamanho do fonte (ordem e vazão do -j)
+    bool unit = false;     // módulo importado: gera a unidade, sem ligar
+};
+
+// Sem saída explícita, troca a extensão do fonte
+std::string defaultOutput(const std::string& input, const char* extension) {
+    std::string output = input;
+    size_t dot = output.find_last_of('.');
+    if (dot != std::string::npos) {
+        output = output.substr(0, dot);
+    }
+    return output + extension;
+}
+
+// Opções de linha de comando que valem para todos os arquivos
+struct DriverOptions {
+    bool emitC = false;          // --emit=c: gera C++ em vez de assembly da VM
+    bool emitUnit = false;       // -c: gera a unidade (.mo) para ligar depois
+    std::string profileFile;     // --profile-use: perfil gravado pela VM
+    std::map<std::string, SiteProfile> profile;   // lido uma vez, no main
+    std::string profileSource;   // hash do fonte de que o perfil foi gravado
+    CodegenOptions codegen;
+    ModuleCache* modules = nullptr;   // unidades dos módulos importados
+    PassTimes* timePasses = nullptr;  // --time-passes (um arquivo só)
+};
+
+const char* outputExtension(const DriverOptions& opts) {
+    return opts.emitC ? ".cpp" : opts.emitUnit ? ".mo" : ".asm";
+}
+
+// Opções que mudam o código de uma unidade: uma unidade em cache gerada com
+// outras opções é recompilada
+std::string codegenSignature(const CodegenOptions& options) {
+    return "--unroll=" + std::to_string(options.unrollFactor) + " --unroll-max=" + std::to_string(options.unrollMaxInstrs)
+         + (options.lineTable ? " -g" : "");
+}
+
+// IMPORT_ERROR: módulo inexistente, importação circular ou erro num módulo
+enum class CompileStatus { OK, SYNTAX_ERROR, IO_ERROR, LINK_ERROR, STACK_ERROR, IMPORT_ERROR };
+
+// Mensagens de outro arquivo, com o nome dele na frente de cada linha
+void appendPrefixed(std::string& to, const std::string& file, const std::string& messages) {
+    std::istringstream lines(messages);
+    for (std::string line; std::getline(lines, line); ) to += file + ": " + line + "\n";
+}
+
+// --run e --emit=c: a AST de cada módulo importado é analisada no mesmo
+// contexto do programa (as variáveis são as mesmas) e fica no ImportStmt.
+// `chain` são os arquivos sendo importados, para achar ciclos. No assembly
+// os módulos são unidades à parte, ligadas depois (linker.h).
+bool parseImports(CompileContext& context, Block* program, const std::string& file, std::vector<std::string>& chain) {
+    std::vector<ImportStmt*> imports;
+    program->collectImports(imports);
+    for (ImportStmt* import : imports) {
+        std::string path = resolveImport(file, import->getPath());
+        if (std::find(chain.begin(), chain.end(), path) != chain.end()) {
+            context.diagnostics += file + ": importação circular de " + path + "\n";
+            return false;
+        }
+        SourceFile source;
+        if (!source.open(path)) {
+            context.diagnostics += "Erro ao abrir o módulo: " + path + "\n";
+            return false;
+        }
+
+        Block* saved = context.root;
+        std::string messages;
+        std::swap(messages, context.diagnostics);
+        bool parsed = parseProgram(context, source);
+        std::swap(messages, context.diagnostics);
+        appendPrefixed(context.diagnostics, path, messages);
+        import->module = context.root;
+        context.root = saved;
+        if (!parsed) return false;
+
+        chain.push_back(path);
+        bool ok = parseImports(context, import->module, path, chain);
+        chain.pop_back();
+        if (!ok) return false;
+    }
+    return true;
+}
+
+bool parseImports(CompileContext& context, const std::string& file) {
+    std::vector<std::string> chain{std::filesystem::path(file).lexically_normal().generic_string()};
+    return parseImports(context, context.root, file, chain);
+}
+
+ModuleCache::Compiler moduleCompiler(const DriverOptions& opts);
+
+// Liga a unidade em `out` (um programa que importa módulos) e troca o
+// conteúdo de `out` pelo programa ligado
+CompileStatus linkProgram(AsmEmitter& out, const DriverOptions& opts, std::string& errors) {
+    AsmUnit main;
+    std::string error;
+    if (!main.parse(out.view(), error)) {
+        errors += error + "\n";
+        return CompileStatus::LINK_ERROR;
+    }
+    std::unique_ptr<ModuleCache> local;
+    if (!opts.modules) local = std::make_unique<ModuleCache>(codegenSignature(opts.codegen), moduleCompiler(opts));
+    Linker linker(opts.modules ? *opts.modules : *local);
+    AsmEmitter linked;
+    if (!linker.link(main, linked, errors)) {
+        errors += "Erro ao ligar os módulos. Assembly não gerado.\n";
+        return linker.failedToImport() ? CompileStatus::IMPORT_ERROR : CompileStatus::LINK_ERROR;
+    }
+    out = std::move(linked);
+    return CompileStatus::OK;
+}
+
+// Compila um fonte já em memória num contexto próprio e gera a saída em
+// `out`. Nada é impresso aqui: as mensagens vão para `errors`, para que o -j
+// imprima cada arquivo inteiro e o --serve as devolva ao cliente.
+CompileStatus compileSource(SourceFile& source, const CompileJob& job, const DriverOptions& opts,
+                            AsmEmitter& out, std::string& errors) {
+    CompileContext context;
+    context.options = opts.codegen;
+
+    // --time-passes: o léxico é medido numa varredura só dele; o parse chama
+    // o lexer de novo, e esse tempo é descontado do sintático
+    if (opts.timePasses) {
+        CompileContext scratch;
+        size_t tokens = PassTimes::run(opts.timePasses, "léxico",
+                                       [&] { return lexBuffer(scratch, source.data(), source.bufferSize()); });
+        opts.timePasses->find("léxico")->note = std::to_string(tokens) + " tokens";
     }
 
-    std::string inputFile  = argv[1];
-    std::string outputFile;
+    // Agora: COMPILA para .asm (ou C++, com --emit=c) em vez de executar a AST
+    bool parsed = PassTimes::run(opts.timePasses, "sintático", [&] { return parseProgram(context, source); });
+    if (opts.timePasses) opts.timePasses->discount("sintático", "léxico");
+    errors = context.diagnostics;
+    if (!parsed) {
+        errors += std::string("Erro de sintaxe. ") + (opts.emitC ? "C++ não gerado" : "Assembly não gerado") + ".\n";
+        return CompileStatus::SYNTAX_ERROR;
+    }
 
-    // Se o usuário passar o .asm explicitamente, usa. Senão, troca a extensão.
-    if (argc >= 3) {
-        outputFile = argv[2];
+    // As chaves do perfil seguem a ordem dos nós do fonte: um perfil de
+    // outra versão do fonte poria as contagens nos desvios errados
+    std::string sourceHash = source.hash();
+    bool useProfile = !opts.profileFile.empty() && !job.unit;
+    if (useProfile && opts.profileSource != sourceHash) {
+        errors += "Aviso: o perfil " + opts.profileFile +
+                  (opts.profileSource.empty() ? " não traz o hash do fonte" : " foi gravado para outra versão do fonte") +
+                  "; compilado sem perfil\n";
+        useProfile = false;
+    }
+    if (useProfile) context.siteProfiles = opts.profile;
+
+    CompileContext::Scope scope(context);
+    Block* rootBlock = context.root;
+    std::vector<ImportStmt*> imports;
+    rootBlock->collectImports(imports);
+    if (opts.emitC) {
+        if (!imports.empty()
+            && !PassTimes::run(opts.timePasses, "importações", [&] { return parseImports(context, job.input); })) {
+            errors = context.diagnostics + "Erro ao importar os módulos. C++ não gerado.\n";
+            return CompileStatus::IMPORT_ERROR;
+        }
+
+        AsmEmitter body, constants(4096);
+        CGen c(body, constants);
+        PassTimes::run(opts.timePasses, "geração C++", [&] { rootBlock->generateC(c); });
+
+        PassTimes::Scope assembling(opts.timePasses, "montagem");
+        out = AsmEmitter(body.size() + constants.size() + 4096);
+        out.put("// Arquivo gerado pelo compilador Maiêutic\n");
+        out.put("// Fonte: ").put(job.input).put("\n");
+        out.put("// g++ -std=c++17 -O2 -I src/runtime ").put(job.output).put(" -o programa\n\n");
+        out.put("#include \"maieutic_rt.h\"\n\n");
+
+        for (size_t i = 0; i < context.slotNames.size(); ++i) {
+            out.put("static rt::Value v").put(i).put(";  // ").put(context.slotNames[i]).put('\n');
+        }
+        out.append(constants);
+        out.put("\nint main() {\n");
+        out.append(body);
+        out.put("    return 0;\n}\n");
     } else {
-        outputFile = inputFile;
-        size_t dot = outputFile.find_last_of('.');
-        if (dot != std::string::npos) {
-            outputFile = outputFile.substr(0, dot);
+        // Uma unidade (-c, módulo importado ou programa que importa) é
+        // ligada a código que esta compilação não vê, e que pode criar
+        // apelidos para qualquer lista
+        bool unit = job.unit || opts.emitUnit || !imports.empty();
+        {
+            PassTimes::Scope aliases(opts.timePasses, "apelidos");
+            rootBlock->collectAliases(context.aliasedLists);
+            if (unit) {
+                for (Symbol s = 0; s < (Symbol)context.symbolNames.size(); ++s) context.aliasedLists.insert(s);
+            }
+        }
+
+        // Gera o corpo antes do cabeçalho: os slots das variáveis são
+        // numerados durante a geração. Invariantes e desenrolamento (3.3)
+        // são decididos durante a geração, e o tempo deles entra aqui.
+        AsmEmitter body;
+        PassTimes::run(opts.timePasses, "geração", [&] { rootBlock->generate(body); });
+
+        // Profundidade máxima da pilha (.STACK); a de um programa que
+        // importa módulos é calculada depois de ligado
+        size_t stackDepth = 0;
+        std::string stackError;
+        StackDepth stack;
+        if (!unit && !PassTimes::run(opts.timePasses, "pilha", [&] {
+                return stack.add(body.view(), stackError) && stack.add("HALT\n", stackError)
+                    && stack.add(context.coldCode.view(), stackError) && stack.analyze(stackDepth, stackError);
+            })) {
+            errors += "Erro na pilha do código gerado: " + stackError + "\nAssembly não gerado.\n";
+            return CompileStatus::STACK_ERROR;
+        }
+
+        {
+            PassTimes::Scope assembling(opts.timePasses, "montagem");
+            out = AsmEmitter(body.size() + 4096);
+            out.put(unit ? "; Unidade compilada pelo compilador Maiêutic\n" : "; Arquivo gerado pelo compilador Maiêutic\n");
+            out.put("; Fonte: ").put(job.input).put("\n");
+            if (useProfile) out.put("; Perfil: ").put(opts.profileFile).put("\n");
+            if (unit) {
+                out.put(".UNIT ").put(job.input).put('\n');
+                out.put(".CODEGEN ").put(codegenSignature(opts.codegen)).put('\n');
+            }
+            out.put(".SOURCE_HASH ").put(sourceHash).put('\n');
+            out.put('\n');
+
+            if (!unit) out.put(".STACK ").put(stackDepth).put('\n');
+            out.put(".SLOTS ").put(context.slotNames.size()).put('\n');
+            for (size_t i = 0; i < context.slotNames.size(); ++i) {
+                out.put(".SYM ").put(i).put(' ').put(context.slotNames[i]).put('\n');
+            }
+            out.put('\n');
+
+            // Tabela de linhas (-g): as .LINE do corpo são linhas deste fonte
+            if (opts.codegen.lineTable) out.put(".FILE ").put(job.input).put('\n');
+            out.append(body);
+
+            out.put("\nHALT\n");
+
+            if (context.coldCode.size() > 0) {
+                out.put("\n; Código frio (pouco executado segundo o perfil)\n");
+                out.append(context.coldCode);
+            }
+        }
+
+        if (unit && !job.unit && !opts.emitUnit) {
+            return PassTimes::run(opts.timePasses, "ligação", [&] { return linkProgram(out, opts, errors); });
         }
-        outputFile += ".asm";
     }
 
-    FILE *file = fopen(inputFile.c_str(), "r");
-    if (!file) {
-        std::cerr << "Erro ao abrir o arquivo: " << inputFile << std::endl;
+    return CompileStatus::OK;
+}
+
+// Compila um arquivo e grava a saída; o aviso de sucesso vai para `report`
+CompileStatus compileFile(const CompileJob& job, const DriverOptions& opts, std::string& report, std::string& errors) {
+    SourceFile source;
+    if (!PassTimes::run(opts.timePasses, "leitura", [&] { return source.open(job.input); })) {
+        errors = "Erro ao abrir o arquivo: " + job.input + "\n";
+        return CompileStatus::IO_ERROR;
+    }
+    if (opts.timePasses) opts.timePasses->find("leitura")->note = std::to_string(source.size()) + " bytes";
+
+    AsmEmitter out;
+    CompileStatus status = compileSource(source, job, opts, out, errors);
+    if (status != CompileStatus::OK) return status;
+
+    if (!PassTimes::run(opts.timePasses, "escrita", [&] { return out.writeTo(job.output); })) {
+        errors += "Erro ao criar arquivo de saída: " + job.output + "\n";
+        return CompileStatus::IO_ERROR;
+    }
+
+    report = (opts.emitC ? "C++ gerado em: " : opts.emitUnit ? "Unidade gerada em: " : "Assembly gerado em: ") + job.output + "\n";
+    return CompileStatus::OK;
+}
+
+// Módulo importado: compilado como unidade, sem perfil (os sites do perfil
+// são os do programa principal). As mensagens levam o nome do módulo.
+bool compileModule(const std::string& path, const DriverOptions& opts, AsmEmitter& out, std::string& errors) {
+    SourceFile source;
+    if (!source.open(path)) {
+        errors += "Erro ao abrir o módulo: " + path + "\n";
+        return false;
+    }
+    DriverOptions moduleOpts;
+    moduleOpts.codegen = opts.codegen;
+    CompileJob job;
+    job.input = path;
+    job.unit = true;
+    std::string messages;
+    bool ok = compileSource(source, job, moduleOpts, out, messages) == CompileStatus::OK;
+    appendPrefixed(errors, path, messages);
+    return ok;
+}
+
+ModuleCache::Compiler moduleCompiler(const DriverOptions& opts) {
+    return [&opts](const std::string& path, AsmEmitter& out, std::string& errors) {
+        return compileModule(path, opts, out, errors);
+    };
+}
+
+// --link: liga uma unidade gerada com -c e os módulos que ela importa
+CompileStatus linkUnitFile(const CompileJob& job, const DriverOptions& opts, std::string& report, std::string& errors) {
+    std::string text;
+    if (!readWholeFile(job.input, text)) {
+        errors = "Erro ao abrir o arquivo: " + job.input + "\n";
+        return CompileStatus::IO_ERROR;
+    }
+    AsmEmitter out(text.size() + 2);
+    out.put(text);
+    CompileStatus status = linkProgram(out, opts, errors);
+    if (status != CompileStatus::OK) return status;
+    if (!out.writeTo(job.output)) {
+        errors += "Erro ao criar arquivo de saída: " + job.output + "\n";
+        return CompileStatus::IO_ERROR;
+    }
+    report = "Assembly gerado em: " + job.output + "\n";
+    return CompileStatus::OK;
+}
+
+// Fontes listados num manifesto (--manifest): um caminho por linha; linhas
+// vazias e iniciadas por '#' são ignoradas
+bool readManifest(const std::string& path, std::vector<std::string>& files) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+        files.push_back(line);
+    }
+    return true;
+}
+
+// -j N: compila os arquivos em N threads. Cada thread tira o próximo arquivo
+// de uma fila comum, com os maiores primeiro, para que nenhum arquivo grande
+// fique sozinho no fim enquanto as outras threads esperam. Devolve quantos
+// arquivos falharam.
+size_t compileBatch(std::vector<CompileJob>& jobs, const DriverOptions& opts, unsigned threads) {
+    std::stable_sort(jobs.begin(), jobs.end(),
+                     [](const CompileJob& a, const CompileJob& b) { return a.bytes > b.bytes; });
+
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> failed{0};
+    std::mutex printing;
+    auto start = std::chrono::steady_clock::now();
+
+    auto worker = [&] {
+        for (size_t i = next++; i < jobs.size(); i = next++) {
+            std::string report, errors;
+            if (compileFile(jobs[i], opts, report, errors) != CompileStatus::OK) ++failed;
+
+            std::lock_guard<std::mutex> lock(printing);
+            std::cout << report;
+            std::istringstream lines(errors);
+            for (std::string line; std::getline(lines, line); ) {
+                std::cerr << jobs[i].input << ": " << line << '\n';
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads && t < jobs.size(); ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool) t.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    size_t bytes = 0;
+    for (const auto& job : jobs) bytes += job.bytes;
+    if (seconds <= 0) seconds = 1e-9;
+
+    char summary[200];
+    std::snprintf(summary, sizeof summary,
+                  "Compilados %zu de %zu arquivos em %.3f s com %u threads: %.1f arquivos/s, %.2f MB/s\n",
+                  jobs.size() - failed, jobs.size(), seconds, threads,
+                  jobs.size() / seconds, bytes / seconds / 1e6);
+    std::cout << summary;
+    return failed;
+}
+
+#if MAIEUTIC_SERVER
+// --serve: cada pedido é compilado num contexto próprio, como um arquivo do
+// -j, e a saída volta ao cliente em vez de ir para o disco
+void serveRequest(const DriverOptions& opts, ServerRequest& request, ServerReply& reply) {
+    CompileJob job;
+    job.input = request.name;
+    job.output = defaultOutput(request.name, outputExtension(opts));
+    if (request.fromFile && !request.source.open(request.name)) {
+        reply.diagnostics = "Erro ao abrir o arquivo: " + request.name + "\n";
+        return;
+    }
+    reply.ok = compileSource(request.source, job, opts, reply.output, reply.diagnostics) == CompileStatus::OK;
+}
+
+// --connect: compila pelo servidor e grava a saída como o compilador local
+// gravaria. Com --bench=N repete o pedido N vezes e mede a ida e volta.
+int compileRemote(const std::string& socketPath, const CompileJob& job, bool emitC, size_t benchRuns) {
+    SourceFile source;
+    if (!source.open(job.input)) {
+        std::cerr << "Erro ao abrir o arquivo: " << job.input << std::endl;
+        return 1;
+    }
+    ServerClient client;
+    if (!client.connect(socketPath)) {
+        std::cerr << "Erro ao conectar ao servidor: " << socketPath << std::endl;
         return 1;
     }
-    yyin = file;
 
-    if (indent_stack.empty()) indent_stack.push(0);
+    bool ok = false;
+    std::string output, diagnostics;
+    std::vector<double> micros;
+    for (size_t i = 0; i < std::max<size_t>(benchRuns, 1); ++i) {
+        auto start = std::chrono::steady_clock::now();
+        if (!client.compile(job.input, source.data(), source.size(), ok, output, diagnostics)) {
+            std::cerr << "Conexão com o servidor perdida: " << socketPath << std::endl;
+            return 1;
+        }
+        micros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
 
-    // Agora: COMPILA para .asm em vez de executar a AST
-    if (yyparse() == 0 && rootBlock != nullptr) {
-        std::ofstream out(outputFile);
-        if (!out) {
-            std::cerr << "Erro ao criar arquivo de saída: " << outputFile << std::endl;
-            fclose(file);
+    std::cerr << diagnostics;
+    if (ok) {
+        std::ofstream out(job.output, std::ios::binary);
+        if (!out.write(output.data(), output.size())) {
+            std::cerr << "Erro ao criar arquivo de saída: " << job.output << std::endl;
             return 1;
         }
+        std::cout << (emitC ? "C++ gerado em: " : "Assembly gerado em: ") << job.output << std::endl;
+    }
 
-        out << "; Arquivo gerado pelo compilador Maiêutic\n";
-        out << "; Fonte: " << inputFile << "\n\n";
+    if (benchRuns > 0) {
+        double total = 0;
+        for (double us : micros) total += us;
+        std::sort(micros.begin(), micros.end());
+        auto at = [&](double q) { return micros[std::min(micros.size() - 1, (size_t)(q * micros.size()))]; };
+        char summary[200];
+        std::snprintf(summary, sizeof summary,
+                      "%zu pedidos: mediana %.1f us, p90 %.1f us, p99 %.1f us, %.0f pedidos/s\n",
+                      micros.size(), at(0.5), at(0.9), at(0.99), micros.size() / (total / 1e6));
+        std::cout << summary;
+    }
+    return 0;
+}
+#endif
+
+// Com -DMAIEUTIC_LIBRARY o compilador vira biblioteca (libmaieutic.a, para
+// o plugin do editor), sem o main da linha de comando
+#ifndef MAIEUTIC_LIBRARY
+
+// Alocações contadas por thread para o --time-passes (passes.h); o custo,
+// sempre pago, é somar dois contadores em cada new
+void* operator new(size_t size) {
+    ++allocationCounters.count;
+    allocationCounters.bytes += size;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
 
-        rootBlock->generate(out);
+// Fora de linha: com o free visível junto do new, o GCC acusa um
+// -Wmismatched-new-delete falso
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, size_t) noexcept { std::free(p); }
 
-        out << "\nHALT\n";
+int main(int argc, char** argv) {
+    DriverOptions opts;
+    JitOptions jit;
+    std::vector<std::string> files;
+    bool run = false;     // --run: executa a AST no interpretador (com JIT)
+    unsigned threads = 0; // -j N: threads da compilação em lote (0: uma por núcleo)
+    bool batch = false;
+    bool serve = false;   // --serve[=socket]: servidor de compilação
+    size_t serveMaxBytes = SERVER_MAX_BYTES;   // --serve-max-bytes: maior SOURCE aceito
+    bool serveLimit = false;
+    std::string socketPath, connectPath;
+    size_t benchRuns = 0;
+    bool link = false;    // --link: liga uma unidade gerada com -c
+    bool timePasses = false;   // --time-passes: tempo e alocações de cada passada
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--emit=c" || arg == "--emit=asm") {
+            opts.emitC = (arg == "--emit=c");
+        } else if (arg == "-c") {
+            opts.emitUnit = true;
+        } else if (arg == "-g") {
+            opts.codegen.lineTable = true;
+        } else if (arg == "--link") {
+            link = true;
+        } else if (arg == "--time-passes") {
+            timePasses = true;
+        } else if (arg == "--run") {
+            run = true;
+        } else if (arg == "--jit=on" || arg == "--jit=off" || arg == "--jit=force") {
+            jit.enabled = (arg != "--jit=off");
+            if (arg == "--jit=force") jit.threshold = 0;
+        } else if (arg.rfind("--profile-use=", 0) == 0) {
+            opts.profileFile = arg.substr(14);
+        } else if (arg.rfind("--jit-threshold=", 0) == 0) {
+            jit.threshold = std::atol(arg.c_str() + 16);
+        } else if (arg.rfind("--unroll=", 0) == 0) {
+            opts.codegen.unrollFactor = std::atoi(arg.c_str() + 9);
+        } else if (arg.rfind("--unroll-max=", 0) == 0) {
+            opts.codegen.unrollMaxInstrs = std::atoi(arg.c_str() + 13);
+        } else if (arg == "-j" || (arg.rfind("-j", 0) == 0 && arg.size() > 2)) {
+            std::string n = arg.size() > 2 ? arg.substr(2) : (i + 1 < argc ? argv[++i] : "");
+            threads = (unsigned)std::atoi(n.c_str());
+            batch = true;
+        } else if (arg.rfind("--manifest=", 0) == 0) {
+            if (!readManifest(arg.substr(11), files)) {
+                std::cerr << "Erro ao abrir o manifesto: " << arg.substr(11) << std::endl;
+                return 1;
+            }
+            batch = true;
+        } else if (arg == "--serve" || arg.rfind("--serve=", 0) == 0) {
+            serve = true;
+            socketPath = arg.size() > 7 ? arg.substr(8) : "";
+        } else if (arg.rfind("--serve-max-bytes=", 0) == 0) {
+            char* rest;
+            serveMaxBytes = std::strtoull(arg.c_str() + 18, &rest, 10);
+            serveLimit = true;
+            if (!std::isdigit((unsigned char)arg[18]) || *rest != '\0' || serveMaxBytes == 0) {
+                std::cerr << "Limite inválido: " << arg << std::endl;
+                return 1;
+            }
+        } else if (arg.rfind("--connect=", 0) == 0) {
+            connectPath = arg.substr(10);
+        } else if (arg.rfind("--bench=", 0) == 0) {
+            benchRuns = std::strtoul(arg.c_str() + 8, nullptr, 10);
+        } else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "Opção desconhecida: " << arg << std::endl;
+            return 1;
+        } else {
+            files.push_back(arg);
+        }
+    }
 
-        std::cout << "Assembly gerado em: " << outputFile << std::endl;
+    bool usage = opts.codegen.unrollFactor < 1 || (opts.emitUnit && (opts.emitC || run || link));
+    if (serve) {
+        usage = usage || !files.empty() || run || link || opts.emitUnit || !connectPath.empty() || benchRuns > 0;
+    } else if (!connectPath.empty()) {
+        usage = usage || files.empty() || files.size() > 2 || run || batch || link || opts.emitUnit
+             || !opts.profileFile.empty();
+    } else if (link) {
+        usage = usage || files.empty() || files.size() > 2 || run || batch || opts.emitC || benchRuns > 0;
     } else {
-        std::cerr << "Erro de sintaxe. Assembly não gerado." << std::endl;
+        usage = usage || files.empty() || benchRuns > 0
+             || (batch ? run || !opts.profileFile.empty() : files.size() > (run ? 1 : 2));
+    }
+    usage = usage || (timePasses && (serve || !connectPath.empty() || link || batch || run)) || (serveLimit && !serve);
+    if (usage) {
+        std::cerr << "Uso: " << argv[0] << " [-c | --emit=asm|c] [-g] [--time-passes] [--unroll=N] [--unroll-max=M] [--profile-use=perfil] fonte.ms [saida]" << std::endl;
+        std::cerr << "     " << argv[0] << " --link unidade.mo [saida]" << std::endl;
+        std::cerr << "     " << argv[0] << " -j N [--emit=asm|c] [--manifest=lista] [fonte.ms ...]" << std::endl;
+        std::cerr << "     " << argv[0] << " --run [--jit=on|off|force] [--jit-threshold=N] fonte.ms" << std::endl;
+        std::cerr << "     " << argv[0] << " --serve[=socket] [-j N] [--serve-max-bytes=N] [--emit=asm|c] [--profile-use=perfil]" << std::endl;
+        std::cerr << "     " << argv[0] << " --connect=socket [--bench=N] fonte.ms [saida]" << std::endl;
+        return 1;
     }
 
-    fclose(file);
-    return 0;
+    // O perfil é lido uma vez e copiado para o contexto de cada compilação
+    if (!run && !opts.profileFile.empty()) {
+        CompileContext loader;
+        if (!loader.loadProfile(opts.profileFile)) {
+            std::cerr << "Erro ao abrir o perfil: " << opts.profileFile << std::endl;
+            return 1;
+        }
+        opts.profile = std::move(loader.siteProfiles);
+        opts.profileSource = loader.profileSource;
+    }
+
+    // Unidades dos módulos importados, compartilhadas por todas as compilações
+    ModuleCache modules(codegenSignature(opts.codegen), moduleCompiler(opts));
+    opts.modules = &modules;
+
+    if (serve || !connectPath.empty()) {
+#if MAIEUTIC_SERVER
+        if (!connectPath.empty()) {
+            CompileJob job;
+            job.input = files[0];
+            job.output = files.size() >= 2 ? files[1] : defaultOutput(files[0], outputExtension(opts));
+            return compileRemote(connectPath, job, opts.emitC, benchRuns);
+        }
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        ServerHandler handler = [&opts](ServerRequest& request, ServerReply& reply) { serveRequest(opts, request, reply); };
+        if (socketPath.empty()) {
+            serveStdio(handler, threads, serveMaxBytes);
+            return 0;
+        }
+        std::string error;
+        serveUnixSocket(socketPath, handler, threads, serveMaxBytes, error);
+        std::cerr << "Erro no socket " << socketPath << ": " << error << std::endl;
+        return 1;
+#else
+        std::cerr << "--serve e --connect só existem em sistemas POSIX" << std::endl;
+        return 1;
+#endif
+    }
+
+    if (batch) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<CompileJob> jobs(files.size());
+        for (size_t i = 0; i < files.size(); ++i) {
+            jobs[i].input = files[i];
+            jobs[i].output = defaultOutput(files[i], outputExtension(opts));
+            std::error_code ec;
+            auto size = std::filesystem::file_size(files[i], ec);
+            jobs[i].bytes = ec ? 0 : (size_t)size;
+        }
+        return compileBatch(jobs, opts, threads) == 0 ? 0 : 1;
+    }
+
+    if (link) {
+        CompileJob job;
+        job.input = files[0];
+        job.output = files.size() >= 2 ? files[1] : defaultOutput(files[0], ".asm");
+        std::string report, errors;
+        CompileStatus status = linkUnitFile(job, opts, report, errors);
+        std::cout << report;
+        std::cerr << errors;
+        return status == CompileStatus::OK ? 0 : 1;
+    }
+
+    if (run) {
+        CompileContext context;
+        context.jit = jit;
+        SourceFile source;
+        if (!source.open(files[0])) {
+            std::cerr << "Erro ao abrir o arquivo: " << files[0] << std::endl;
+            return 1;
+        }
+        bool parsed = parseProgram(context, source);
+        if (!parsed) {
+            std::cerr << context.diagnostics << "Erro de sintaxe. Programa não executado." << std::endl;
+            return 0;
+        }
+        if (!parseImports(context, files[0])) {
+            std::cerr << context.diagnostics << "Erro ao importar os módulos. Programa não executado." << std::endl;
+            return 1;
+        }
+        std::cerr << context.diagnostics;
+        CompileContext::Scope scope(context);
+        context.root->execute();
+        return 0;
+    }
+
+    // Se o usuário passar a saída explicitamente, usa. Senão, troca a extensão.
+    CompileJob job;
+    job.input = files[0];
+    job.output = files.size() >= 2 ? files[1] : defaultOutput(files[0], outputExtension(opts));
+
+    PassTimes passes;
+    if (timePasses) opts.timePasses = &passes;
+    std::string report, errors;
+    CompileStatus status = compileFile(job, opts, report, errors);
+    std::cout << report;
+    std::cerr << errors;
+    if (timePasses) passes.print(stderr, job.input);
+    // Um erro de sintaxe no próprio fonte sai com 0, como sempre saiu
+    return status == CompileStatus::OK || status == CompileStatus::SYNTAX_ERROR ? 0 : 1;
 }
+#endif
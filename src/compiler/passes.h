@@ -0,0 +1,123 @@
+#ifndef PASSES_H
+#define PASSES_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Tempo e alocações de cada passada de uma compilação (--time-passes).
+//
+// As alocações são contadas pelo operator new do executável maieutic
+// (parser.y), por thread; na biblioteca (libmaieutic.a) o operator new é o
+// padrão e os contadores ficam em zero.
+struct AllocationCounters {
+    size_t count = 0;
+    size_t bytes = 0;
+};
+
+inline thread_local AllocationCounters allocationCounters;
+
+class PassTimes {
+public:
+    struct Pass {
+        std::string name;
+        double seconds = 0;
+        size_t allocations = 0;
+        size_t bytes = 0;
+        std::string note;       // ex.: quantos tokens o léxico leu
+
+        explicit Pass(std::string name) : name(std::move(name)) {}
+    };
+
+    // Mede do construtor ao destrutor o trecho como a passada `name`; sem
+    // `times` (a opção desligada), não faz nada. Passadas com o mesmo nome
+    // são somadas.
+    class Scope {
+    public:
+        Scope(PassTimes* times, const char* name) : times(times), name(name) {
+            if (times) {
+                before = allocationCounters;
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~Scope() {
+            if (!times) return;
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            size_t allocations = allocationCounters.count - before.count;
+            size_t bytes = allocationCounters.bytes - before.bytes;
+            Pass* p = times->find(name);
+            if (!p) {
+                times->passes.emplace_back(name);
+                p = &times->passes.back();
+            }
+            p->seconds += seconds;
+            p->allocations += allocations;
+            p->bytes += bytes;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        PassTimes* times;
+        const char* name;
+        std::chrono::steady_clock::time_point start;
+        AllocationCounters before;
+    };
+
+    // Roda `work` medindo-o como a passada `name`
+    template <class F>
+    static auto run(PassTimes* times, const char* name, F&& work) -> decltype(work()) {
+        Scope scope(times, name);
+        return work();
+    }
+
+    Pass* find(const std::string& name) {
+        for (Pass& p : passes) {
+            if (p.name == name) return &p;
+        }
+        return nullptr;
+    }
+
+    // Tira de `whole` o que foi medido em `part` (o parse chama o lexer: o
+    // tempo só do parser é o do parse menos o do léxico)
+    void discount(const std::string& whole, const std::string& part) {
+        Pass* w = find(whole);
+        Pass* p = find(part);
+        if (!w || !p) return;
+        w->seconds = w->seconds > p->seconds ? w->seconds - p->seconds : 0;
+        w->allocations = w->allocations > p->allocations ? w->allocations - p->allocations : 0;
+        w->bytes = w->bytes > p->bytes ? w->bytes - p->bytes : 0;
+    }
+
+    void print(std::FILE* out, const std::string& source) const {
+        Pass total("total");
+        for (const Pass& p : passes) {
+            total.seconds += p.seconds;
+            total.allocations += p.allocations;
+            total.bytes += p.bytes;
+        }
+        std::fprintf(out, "[time-passes] %s\n", source.c_str());
+        // larguras em bytes: "alocações" tem dois caracteres de 2 bytes
+        std::fprintf(out, "  %-20s %12s %7s %14s %14s\n", "passada", "tempo (ms)", "%", "alocações", "bytes alocados");
+        auto line = [&](const Pass& p) {
+            // "%-20s" conta bytes: acerta a coluna dos nomes acentuados
+            int pad = 20;
+            for (char c : p.name) pad += (c & 0xC0) == 0x80;
+            std::fprintf(out, "  %-*s %12.3f %6.1f%% %12zu %14zu", pad, p.name.c_str(), p.seconds * 1000,
+                         total.seconds > 0 ? 100 * p.seconds / total.seconds : 0.0, p.allocations, p.bytes);
+            if (p.note.empty()) std::fprintf(out, "\n");
+            else std::fprintf(out, "  %s\n", p.note.c_str());
+        };
+        for (const Pass& p : passes) line(p);
+        line(total);
+    }
+
+    std::vector<Pass> passes;
+};
+
+#endif
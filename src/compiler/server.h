@@ -0,0 +1,404 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "emitter.h"
+#include "source.h"
+
+// Servidor de compilação (maieutic --serve): um processo que fica no ar e
+// compila os pedidos que chegam, sem pagar a criação do processo e a carga
+// do binário a cada roteiro. Os pedidos vêm pela entrada padrão (respostas
+// na saída padrão) ou por um socket Unix, de vários clientes ao mesmo tempo.
+//
+// Cada mensagem é uma linha de cabeçalho seguida de bytes:
+//
+//   pedido    <id> FILE <caminho>\n                compila o arquivo
+//             <id> SOURCE <n> [nome]\n<n bytes>    compila o texto enviado
+//   resposta  <id> OK <n> <m>\n<n bytes><m bytes>  saída (.asm ou C++) e avisos
+//             <id> ERROR <m>\n<m bytes>            mensagens de erro
+//
+// O id (sem espaços) é escolhido pelo cliente e volta na resposta: os
+// pedidos de uma conexão são compilados em paralelo e as respostas saem na
+// ordem em que ficam prontas. Um SOURCE maior que o limite do servidor
+// (--serve-max-bytes) recebe ERROR e o texto é descartado sem ser guardado.
+#if defined(__unix__) || defined(__APPLE__)
+#define MAIEUTIC_SERVER 1
+#include <cerrno>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+#else
+#define MAIEUTIC_SERVER 0
+#endif
+
+// Padrão do --serve-max-bytes
+inline constexpr size_t SERVER_MAX_BYTES = (size_t)8 << 20;
+
+#if MAIEUTIC_SERVER
+
+struct ServerRequest {
+    std::string id;
+    std::string name;        // caminho (FILE) ou nome dado ao texto (SOURCE)
+    bool fromFile = false;
+    SourceFile source;       // SOURCE: o texto, lido direto para o buffer do lexer
+};
+
+struct ServerReply {
+    bool ok = false;
+    AsmEmitter output{0};
+    std::string diagnostics;
+};
+
+using ServerHandler = std::function<void(ServerRequest&, ServerReply&)>;
+
+// Leitura com buffer de um descritor: linhas de cabeçalho e blocos de bytes
+class FdReader {
+    int fd;
+    std::vector<char> buf = std::vector<char>(1 << 16);
+    size_t begin = 0, end = 0;
+
+    bool fill() {
+        ssize_t n;
+        do n = ::read(fd, buf.data(), buf.size()); while (n < 0 && errno == EINTR);
+        if (n <= 0) return false;
+        begin = 0;
+        end = (size_t)n;
+        return true;
+    }
+
+public:
+    explicit FdReader(int f) : fd(f) {}
+
+    // Próxima linha, sem o '\n'; false no fim da entrada
+    bool line(std::string& out) {
+        out.clear();
+        for (;;) {
+            if (begin == end && !fill()) return !out.empty();
+            char* start = buf.data() + begin;
+            char* nl = (char*)std::memchr(start, '\n', end - begin);
+            if (nl) {
+                out.append(start, nl - start);
+                begin += nl - start + 1;
+                return true;
+            }
+            out.append(start, end - begin);
+            begin = end;
+        }
+    }
+
+    // Descarta `n` bytes (o texto de um pedido recusado)
+    bool skip(size_t n) {
+        while (n > 0) {
+            if (begin == end && !fill()) return false;
+            size_t k = std::min(n, end - begin);
+            begin += k;
+            n -= k;
+        }
+        return true;
+    }
+
+    bool bytes(char* dst, size_t n) {
+        size_t buffered = std::min(n, end - begin);
+        std::memcpy(dst, buf.data() + begin, buffered);
+        begin += buffered;
+        for (size_t done = buffered; done < n; ) {
+            ssize_t r = ::read(fd, dst + done, n - done);
+            if (r < 0 && errno == EINTR) continue;
+            if (r <= 0) return false;
+            done += (size_t)r;
+        }
+        return true;
+    }
+};
+
+// Escreve todos os pedaços (cabeçalho e corpo) com o mínimo de chamadas
+inline bool writeAll(int fd, std::vector<iovec> parts) {
+    size_t i = 0;
+    while (i < parts.size()) {
+        ssize_t n = ::writev(fd, &parts[i], (int)(parts.size() - i));
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) return false;
+        size_t left = (size_t)n;
+        while (i < parts.size() && left >= parts[i].iov_len) left -= parts[i++].iov_len;
+        if (i < parts.size()) {
+            parts[i].iov_base = (char*)parts[i].iov_base + left;
+            parts[i].iov_len -= left;
+        }
+    }
+    return true;
+}
+
+// Threads que compilam os pedidos de todas as conexões. Com uma thread só,
+// o pedido é compilado na própria thread de leitura, sem troca de contexto.
+class WorkQueue {
+    std::mutex lock;
+    std::condition_variable ready;
+    std::deque<std::function<void()>> jobs;
+    std::vector<std::thread> workers;
+    bool stopping = false;
+
+    void run() {
+        for (;;) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                ready.wait(guard, [this] { return stopping || !jobs.empty(); });
+                if (jobs.empty()) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            job();
+        }
+    }
+
+public:
+    explicit WorkQueue(unsigned threads) {
+        for (unsigned t = 0; threads > 1 && t < threads; ++t) workers.emplace_back([this] { run(); });
+    }
+
+    // Termina os pedidos já aceitos antes de sair
+    ~WorkQueue() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    void push(std::function<void()> job) {
+        if (workers.empty()) {
+            job();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            jobs.push_back(std::move(job));
+        }
+        ready.notify_one();
+    }
+};
+
+// Um cliente: as respostas de pedidos compilados em threads diferentes são
+// escritas uma de cada vez. O descritor é fechado quando a última resposta
+// pendente sai (a conexão é compartilhada pelos pedidos em andamento).
+class ServerConnection {
+    int in, out;
+    bool owned;
+    std::mutex writing;
+
+public:
+    ServerConnection(int i, int o, bool own) : in(i), out(o), owned(own) {}
+    ServerConnection(const ServerConnection&) = delete;
+    ServerConnection& operator=(const ServerConnection&) = delete;
+    ~ServerConnection() {
+        if (owned) ::close(in);
+    }
+
+    int input() const { return in; }
+
+    bool reply(const std::string& id, ServerReply& reply) {
+        std::string header = id;
+        if (reply.ok) {
+            header += " OK " + std::to_string(reply.output.size()) + " " + std::to_string(reply.diagnostics.size()) + "\n";
+        } else {
+            header += " ERROR " + std::to_string(reply.diagnostics.size()) + "\n";
+        }
+        std::string_view body = reply.ok ? reply.output.view() : std::string_view();
+        std::vector<iovec> parts = {
+            {(void*)header.data(), header.size()},
+            {(void*)body.data(), body.size()},
+            {(void*)reply.diagnostics.data(), reply.diagnostics.size()},
+        };
+        std::lock_guard<std::mutex> guard(writing);
+        return writeAll(out, parts);
+    }
+};
+
+// O <n> de um SOURCE: só dígitos (sem sinal nem espaços), que caibam num
+// size_t, seguidos do fim ou de " nome". `used` recebe quantos bytes de
+// `arg` o número ocupa.
+inline bool parseSourceLength(const std::string& arg, size_t& n, size_t& used) {
+    if (arg.empty() || !std::isdigit((unsigned char)arg[0])) return false;
+    errno = 0;
+    char* rest;
+    unsigned long long value = std::strtoull(arg.c_str(), &rest, 10);
+    if (errno == ERANGE || value > SIZE_MAX || (*rest != '\0' && *rest != ' ')) return false;
+    n = (size_t)value;
+    used = rest - arg.c_str();
+    return true;
+}
+
+// Lê os pedidos de uma conexão até o fim da entrada e os entrega à fila.
+// Um cabeçalho inválido recebe ERROR; um SOURCE acima de `maxBytes` recebe
+// ERROR e o texto dele é descartado; um SOURCE truncado encerra a conexão.
+inline void serveConnection(const std::shared_ptr<ServerConnection>& conn, const ServerHandler& handler, WorkQueue& queue,
+                            size_t maxBytes) {
+    FdReader reader(conn->input());
+    std::string header;
+    while (reader.line(header)) {
+        if (!header.empty() && header.back() == '\r') header.pop_back();
+        if (header.empty()) continue;
+
+        auto request = std::make_shared<ServerRequest>();
+        auto refuse = [&](const std::string& message) {
+            ServerReply refused;
+            refused.diagnostics = message + "\n";
+            conn->reply(request->id, refused);
+        };
+        size_t idEnd = header.find(' ');
+        request->id = header.substr(0, idEnd);
+        size_t kindEnd = idEnd == std::string::npos ? idEnd : header.find(' ', idEnd + 1);
+        std::string kind = idEnd == std::string::npos ? "" : header.substr(idEnd + 1, kindEnd - idEnd - 1);
+        std::string arg = kindEnd == std::string::npos ? "" : header.substr(kindEnd + 1);
+
+        if (kind == "FILE" && !arg.empty()) {
+            request->name = arg;
+            request->fromFile = true;
+        } else if (kind == "SOURCE" && !arg.empty()) {
+            size_t n, used;
+            if (!parseSourceLength(arg, n, used)) {
+                refuse("Tamanho inválido no pedido: " + header);
+                continue;
+            }
+            request->name = used < arg.size() ? arg.substr(used + 1) : "entrada.ms";
+            char* text = nullptr;
+            if (n > maxBytes) {
+                refuse("Fonte de " + std::to_string(n) + " bytes acima do limite do servidor (" +
+                       std::to_string(maxBytes) + " bytes, --serve-max-bytes)");
+            } else if (!(text = request->source.allocate(n))) {
+                refuse("Sem memória para um fonte de " + std::to_string(n) + " bytes");
+            }
+            if (!text) {
+                if (!reader.skip(n)) break;
+                continue;
+            }
+            if (!reader.bytes(text, n)) break;
+        } else {
+            refuse("Pedido inválido: " + header);
+            continue;
+        }
+
+        queue.push([conn, request, &handler] {
+            ServerReply reply;
+            handler(*request, reply);
+            conn->reply(request->id, reply);
+        });
+    }
+}
+
+// Pedidos pela entrada padrão, respostas na saída padrão; volta no fim da
+// entrada, depois das respostas pendentes
+inline void serveStdio(const ServerHandler& handler, unsigned threads, size_t maxBytes) {
+    std::signal(SIGPIPE, SIG_IGN);
+    WorkQueue queue(threads);
+    serveConnection(std::make_shared<ServerConnection>(0, 1, false), handler, queue, maxBytes);
+}
+
+// Socket Unix em `path`: uma thread de leitura por cliente, todas com a
+// mesma fila de compilação. Só volta em caso de erro.
+inline bool serveUnixSocket(const std::string& path, const ServerHandler& handler, unsigned threads, size_t maxBytes,
+                            std::string& error) {
+    std::signal(SIGPIPE, SIG_IGN);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof addr.sun_path) {
+        error = "caminho longo demais para um socket Unix";
+        return false;
+    }
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ::unlink(path.c_str());
+    if (fd < 0 || ::bind(fd, (sockaddr*)&addr, sizeof addr) != 0 || ::listen(fd, 64) != 0) {
+        error = std::strerror(errno);
+        if (fd >= 0) ::close(fd);
+        return false;
+    }
+
+    WorkQueue queue(threads);
+    for (;;) {
+        int client = ::accept(fd, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            error = std::strerror(errno);
+            ::close(fd);
+            return false;
+        }
+        std::thread([client, &handler, &queue, maxBytes] {
+            serveConnection(std::make_shared<ServerConnection>(client, client, true), handler, queue, maxBytes);
+        }).detach();
+    }
+}
+
+// Cliente de um servidor num socket Unix (maieutic --connect)
+class ServerClient {
+    int fd = -1;
+    std::unique_ptr<FdReader> reader;
+    long nextId = 0;
+
+public:
+    ServerClient() = default;
+    ServerClient(const ServerClient&) = delete;
+    ServerClient& operator=(const ServerClient&) = delete;
+    ~ServerClient() {
+        if (fd >= 0) ::close(fd);
+    }
+
+    bool connect(const std::string& path) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof addr.sun_path) return false;
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || ::connect(fd, (sockaddr*)&addr, sizeof addr) != 0) return false;
+        reader = std::make_unique<FdReader>(fd);
+        return true;
+    }
+
+    // Manda o texto de `name` e espera a resposta. false: conexão perdida.
+    bool compile(const std::string& name, const char* data, size_t size,
+                 bool& ok, std::string& output, std::string& diagnostics) {
+        std::string id = std::to_string(nextId++);
+        std::string header = id + " SOURCE " + std::to_string(size) + " " + name + "\n";
+        if (!writeAll(fd, {{(void*)header.data(), header.size()}, {(void*)data, size}})) return false;
+
+        std::string reply;
+        if (!reader->line(reply)) return false;
+        char kind[8] = "";
+        size_t n = 0, m = 0;
+        std::string expected = id + " ";
+        if (reply.compare(0, expected.size(), expected) != 0) return false;
+        int fields = std::sscanf(reply.c_str() + expected.size(), "%7s %zu %zu", kind, &n, &m);
+        ok = std::strcmp(kind, "OK") == 0;
+        if (!ok) {
+            if (fields < 2) return false;
+            m = n;
+            n = 0;
+        } else if (fields < 3) {
+            return false;
+        }
+        output.resize(n);
+        diagnostics.resize(m);
+        return reader->bytes(output.data(), n) && reader->bytes(diagnostics.data(), m);
+    }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef SOURCE_H
+#define SOURCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <string>
+#include <vector>
+
+// Fonte .ms em memória, no formato que o yy_scan_buffer do flex lê no lugar:
+// o texto seguido de dois bytes 0 (YY_END_OF_BUFFER_CHAR). Em sistemas POSIX
+// o arquivo é mapeado com mmap (MAP_PRIVATE: o flex escreve no buffer ao
+// marcar o fim de cada yytext, e só as páginas tocadas viram cópia); nos
+// demais, é lido inteiro de uma vez. O fonte também pode vir da memória
+// (maieutic --serve), escrito direto no buffer devolvido por allocate().
+#if defined(__unix__) || defined(__APPLE__)
+#define MAIEUTIC_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define MAIEUTIC_MMAP 0
+#endif
+
+class SourceFile {
+    char* base = nullptr;
+    size_t length = 0;          // bytes do arquivo, sem os dois 0 finais
+#if MAIEUTIC_MMAP
+    size_t mapped = 0;          // 0: o fonte está em `bytes`
+#endif
+    std::vector<char> bytes;
+
+public:
+    SourceFile() = default;
+    SourceFile(const SourceFile&) = delete;
+    SourceFile& operator=(const SourceFile&) = delete;
+
+    ~SourceFile() {
+#if MAIEUTIC_MMAP
+        if (base && mapped) munmap(base, mapped);
+#endif
+    }
+
+    bool open(const std::string& path) {
+#if MAIEUTIC_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return false;
+        }
+        length = (size_t)st.st_size;
+        mapped = length + 2;
+
+        // Reserva arquivo + 2 bytes em páginas anônimas (zeradas) e mapeia o
+        // arquivo por cima: os 0 finais existem mesmo quando o tamanho do
+        // arquivo é múltiplo da página.
+        void* area = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        bool ok = area != MAP_FAILED;
+        if (ok && length > 0) {
+            ok = mmap(area, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED;
+            if (!ok) munmap(area, mapped);
+        }
+        ::close(fd);
+        if (!ok) return false;
+        base = (char*)area;
+        return true;
+#else
+        FILE* f = std::fopen(path.c_str(), "rb");
+        if (!f) return false;
+        char chunk[1 << 16];
+        size_t n;
+        while ((n = std::fread(chunk, 1, sizeof chunk, f)) > 0) bytes.insert(bytes.end(), chunk, chunk + n);
+        std::fclose(f);
+        length = bytes.size();
+        bytes.push_back(0);
+        bytes.push_back(0);
+        base = bytes.data();
+        return true;
+#endif
+    }
+
+    // Fonte que não vem de arquivo: devolve onde escrever os `n` bytes do
+    // texto, já seguidos dos dois 0, ou nullptr se não houver memória
+    char* allocate(size_t n) {
+        if (n > bytes.max_size() - 2) return nullptr;
+        try {
+            bytes.assign(n + 2, 0);
+        } catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+        length = n;
+        base = bytes.data();
+        return base;
+    }
+
+    // Hash do texto (FNV-1a de 64 bits, em hexadecimal): identifica o fonte
+    // que gerou um perfil (.SOURCE_HASH)
+    std::string hash() const {
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (size_t i = 0; i < length; ++i) {
+            h ^= (unsigned char)base[i];
+            h *= 0x100000001b3ull;
+        }
+        char text[17];
+        std::snprintf(text, sizeof text, "%016llx", (unsigned long long)h);
+        return text;
+    }
+
+    char* data() const { return base; }
+    size_t size() const { return length; }
+    size_t bufferSize() const { return length + 2; }   // para yy_scan_buffer
+};
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef STACKDEPTH_H
+#define STACKDEPTH_H
+
+#include <algorithm>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Profundidade máxima da pilha de operandos de um programa gerado, por
+// interpretação abstrata do fluxo de controle que o compilador emitiu.
+// Cada instrução tem um efeito fixo na pilha (BUILD_LIST n: tira n, põe
+// um); a profundidade na entrada de cada instrução alcançável é propagada
+// pelos caminhos de execução e tem de ser a mesma por todos eles. Com isso
+// a profundidade máxima é exata e vai para o cabeçalho (.STACK <n>): a VM
+// aloca a pilha uma vez só.
+//
+// Um programa em que dois caminhos chegam a um ponto com profundidades
+// diferentes (um laço que empilha a cada volta, por exemplo) não tem
+// profundidade limitada que se possa provar, e é rejeitado.
+//
+// As instruções guardam só views do texto passado a add(), sem copiá-lo:
+// o texto (o buffer do AsmEmitter) tem de existir até o analyze().
+class StackDepth {
+    struct Instr {
+        int pops = 0, pushes = 0;
+        enum Flow { NEXT, JUMP, BRANCH, STOP } flow = NEXT;
+        std::string_view text;     // a linha: label do JUMP/BRANCH e mensagens
+
+        std::string_view target() const {
+            size_t space = text.find(' ');
+            return space == std::string_view::npos ? std::string_view() : text.substr(space + 1);
+        }
+    };
+
+    std::vector<Instr> code;
+    std::unordered_map<std::string_view, size_t> labels;
+
+    static bool effect(std::string_view op, std::string_view arg, Instr& ins) {
+        if (op == "PUSH_NUM" || op == "PUSH_BOOL" || op == "PUSH_STR" || op == "PUSH_NIL"
+            || op == "LOAD_SLOT" || op == "LOAD" || op == "PUSH_R0" || op == "PUSH_R1" || op == "READ_SENSOR") {
+            ins.pushes = 1;
+        } else if (op == "STORE_SLOT" || op == "STORE" || op == "APPEND_SLOT" || op == "APPEND"
+                   || op == "QUESTION" || op == "PRINT" || op == "PRINT_CONCL"
+                   || op == "MOV_TOP_R0" || op == "MOV_TOP_R1") {
+            ins.pops = 1;
+        } else if (op == "STORE_INDEX_SLOT" || op == "STORE_INDEX") {
+            ins.pops = 2;
+        } else if (op == "INDEX" || op == "ADD" || op == "SUB" || op == "MUL" || op == "DIV" || op == "MOD"
+                   || op == "CMP_EQ" || op == "CMP_NEQ" || op == "CMP_LT" || op == "CMP_LTE"
+                   || op == "CMP_GT" || op == "CMP_GTE" || op == "AND" || op == "OR") {
+            ins.pops = 2;
+            ins.pushes = 1;
+        } else if (op == "LEN") {
+            ins.pops = 1;
+            ins.pushes = 1;
+        } else if (op == "BUILD_LIST") {
+            auto [end, ec] = std::from_chars(arg.data(), arg.data() + arg.size(), ins.pops);
+            if (arg.empty() || ec != std::errc() || end != arg.data() + arg.size() || ins.pops < 0) return false;
+            ins.pushes = 1;
+        } else if (op == "INPUT_SLOT" || op == "INPUT") {
+        } else if (op == "JUMP") {
+            ins.flow = Instr::JUMP;
+        } else if (op == "JUMP_IF_FALSE" || op == "JUMP_IF_TRUE") {
+            ins.pops = 1;
+            ins.flow = Instr::BRANCH;
+        } else if (op == "HALT") {
+            ins.flow = Instr::STOP;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+public:
+    // Acrescenta um trecho do programa (corpo, HALT, código frio...), na
+    // ordem em que aparece no arquivo
+    bool add(std::string_view text, std::string& error) {
+        code.reserve(code.size() + std::count(text.begin(), text.end(), '\n') + 1);
+        while (!text.empty()) {
+            size_t nl = text.find('\n');
+            std::string_view line = text.substr(0, nl);
+            text = nl == std::string_view::npos ? std::string_view() : text.substr(nl + 1);
+            while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.remove_suffix(1);
+            while (!line.empty() && line.front() == ' ') line.remove_prefix(1);
+            if (line.empty() || line[0] == ';' || line[0] == '.') continue;
+
+            size_t space = line.find(' ');
+            std::string_view op = line.substr(0, space);
+            std::string_view arg = space == std::string_view::npos ? std::string_view() : line.substr(space + 1);
+            if (op == "LABEL") {
+                labels[arg] = code.size();
+                continue;
+            }
+            Instr ins;
+            ins.text = line;
+            if (!effect(op, arg, ins)) {
+                error = "instrução sem efeito conhecido na pilha: " + std::string(line);
+                return false;
+            }
+            code.push_back(ins);
+        }
+        return true;
+    }
+
+    // Profundidade máxima a partir da primeira instrução, com a pilha vazia
+    bool analyze(size_t& maxDepth, std::string& error) const {
+        std::vector<long> depth(code.size() + 1, -1);   // +1: fim do programa
+        std::vector<size_t> work;
+        maxDepth = 0;
+
+        auto reach = [&](size_t at, long d, const Instr& from) {
+            if (depth[at] < 0) {
+                depth[at] = d;
+                work.push_back(at);
+                return true;
+            }
+            if (depth[at] == d) return true;
+            error = "pilha com " + std::to_string(d) + " e " + std::to_string(depth[at])
+                  + " valores no mesmo ponto (depois de " + std::string(from.text) + ")";
+            return false;
+        };
+
+        if (code.empty()) return true;
+        depth[0] = 0;
+        work.push_back(0);
+        while (!work.empty()) {
+            size_t pc = work.back();
+            work.pop_back();
+            if (pc == code.size()) continue;
+            const Instr& ins = code[pc];
+            long d = depth[pc];
+            if (d < ins.pops) {
+                error = "pilha com " + std::to_string(d) + " valores em " + std::string(ins.text);
+                return false;
+            }
+            d += ins.pushes - ins.pops;
+            maxDepth = std::max(maxDepth, (size_t)d);
+
+            if (ins.flow == Instr::JUMP || ins.flow == Instr::BRANCH) {
+                auto target = labels.find(ins.target());
+                if (target == labels.end()) {
+                    error = "label inexistente em " + std::string(ins.text);
+                    return false;
+                }
+                if (!reach(target->second, d, ins)) return false;
+            }
+            if ((ins.flow == Instr::NEXT || ins.flow == Instr::BRANCH) && !reach(pc + 1, d, ins)) return false;
+        }
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef MAIEUTIC_IO_H
+#define MAIEUTIC_IO_H
+
+// E/S do console dos programas Maiêutic: a saída padrão dos executáveis do
+// --emit=c, da SocraticVM nativa e do interpretador (maieutic --run).
+//
+// A saída fica num buffer de 64 KB e só vai para o write(2) quando ele
+// enche, quando a entrada precisa ler mais (antes de bloquear esperando a
+// resposta de um prompt), antes de uma mensagem em stderr e no fim do
+// processo. Com a saída num terminal, vai também a cada linha. A entrada é
+// lida com read(2), em blocos de 64 KB, sem passar pelo stdio.
+//
+// Toda a saída padrão do programa passa por rt::console: misturada com
+// printf/std::cout, a ordem das linhas não é garantida.
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RT_POSIX 1
+#include <cerrno>
+#include <unistd.h>
+#else
+#define RT_POSIX 0
+#endif
+
+namespace rt {
+
+class Console {
+public:
+    static constexpr size_t CAPACITY = 1 << 16;
+
+    Console() = default;
+    Console(const Console&) = delete;
+    Console& operator=(const Console&) = delete;
+
+    // No fim do processo (retorno do main ou std::exit)
+    ~Console() { flush(); }
+
+    void write(const char* data, size_t size) {
+        if (lineMode < 0) lineMode = isTerminal(1);
+        if (size > CAPACITY - used) {
+            flush();
+            if (size >= CAPACITY) {
+                writeAll(1, data, size);
+                return;
+            }
+        }
+        std::memcpy(out + used, data, size);
+        used += size;
+        if (lineMode && std::memchr(data, '\n', size)) flush();
+    }
+
+    void write(const std::string& s) { write(s.data(), s.size()); }
+    void write(const char* s) { write(s, std::strlen(s)); }
+
+    void flush() {
+        if (used == 0) return;
+        size_t size = used;
+        used = 0;
+        writeAll(1, out, size);
+    }
+
+    // Próximo byte da entrada (EOF no fim), sem consumir
+    int peek() {
+        if (pos == end && !fill()) return EOF;
+        return (unsigned char)in[pos];
+    }
+
+    int get() {
+        if (pos == end && !fill()) return EOF;
+        return (unsigned char)in[pos++];
+    }
+
+    // Pula espaços, tabulações e quebras de linha (como std::ws)
+    void skipSpace() {
+        int c;
+        while ((c = peek()) == ' ' || (c >= '\t' && c <= '\r')) ++pos;
+    }
+
+    // Lê uma linha, sem o fim de linha; false se a entrada já acabou. O fim
+    // de linha é "\n" ou, com `universal` (como o input() do Python), também
+    // "\r\n" e "\r".
+    bool readLine(std::string& line, bool universal = false) {
+        line.clear();
+        bool any = false;
+        while (pos < end || fill()) {
+            any = true;
+            const char* start = in + pos;
+            size_t n = end - pos;
+            const char* stop = static_cast<const char*>(std::memchr(start, '\n', n));
+            if (universal) {
+                const char* cr = static_cast<const char*>(std::memchr(start, '\r', stop ? stop - start : n));
+                if (cr) stop = cr;
+            }
+            if (!stop) {
+                line.append(start, n);
+                pos = end;
+                continue;
+            }
+            line.append(start, stop - start);
+            pos += stop - start + 1;
+            if (*stop == '\r' && peek() == '\n') ++pos;
+            return true;
+        }
+        return any;
+    }
+
+private:
+    // Enche o buffer da entrada; antes de ler, esvazia o da saída (o prompt
+    // tem de aparecer antes de o programa ficar esperando)
+    bool fill() {
+        if (eof) return false;
+        flush();
+        pos = end = 0;
+#if RT_POSIX
+        ssize_t n;
+        do {
+            n = ::read(0, in, CAPACITY);
+        } while (n < 0 && errno == EINTR);
+        if (n > 0) end = (size_t)n;
+#else
+        end = std::fread(in, 1, CAPACITY, stdin);
+#endif
+        if (end == 0) eof = true;
+        return end > 0;
+    }
+
+    static bool isTerminal(int fd) {
+#if RT_POSIX
+        return ::isatty(fd);
+#else
+        (void)fd;
+        return false;
+#endif
+    }
+
+    static void writeAll(int fd, const char* data, size_t size) {
+#if RT_POSIX
+        while (size > 0) {
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0 && errno == EINTR) continue;
+            if (written <= 0) return;
+            data += written;
+            size -= (size_t)written;
+        }
+#else
+        (void)fd;
+        std::fwrite(data, 1, size, stdout);
+        std::fflush(stdout);
+#endif
+    }
+
+    char out[CAPACITY];
+    size_t used = 0;
+    int lineMode = -1;          // -1: ainda não sabe se a saída é um terminal
+    char in[CAPACITY];
+    size_t pos = 0, end = 0;
+    bool eof = false;
+};
+
+inline Console console;
+
+} // namespace rt
+
+#endif
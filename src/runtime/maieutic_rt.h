@@ -0,0 +1,366 @@
+#ifndef MAIEUTIC_RT_H
+#define MAIEUTIC_RT_H
+
+// Runtime dos programas gerados por "maieutic --emit=c".
+//
+// Reproduz a semântica da SocraticVM (src/vm/socraticvm.py): formatação de
+// números com "%.15g", listas compartilhadas por referência, regras do INPUT
+// e as mesmas mensagens "[VM] ..." na saída padrão. Onde a VM em Python
+// aborta com uma exceção (ex.: MOD por zero), o programa termina com a
+// mesma mensagem em stderr e código 1.
+//
+// A saída padrão e a entrada passam pelo buffer de rt::console
+// (maieutic_io.h).
+//
+// Compilação:
+//   g++ -std=c++17 -O2 -I src/runtime programa.cpp -o programa
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "maieutic_io.h"
+
+namespace rt {
+
+struct Value;
+using List = std::vector<Value>;
+
+struct Value {
+    enum Type : unsigned char { NIL, BOOL, NUMBER, STRING, LIST } type = NIL;
+    bool boolVal = false;
+    double numVal = 0;              // 0 em tudo que não é NUMBER, como na VM
+    std::string strVal;
+    std::shared_ptr<List> listVal;  // compartilhada entre variáveis
+};
+
+inline Value nil() { return Value(); }
+
+inline Value boolean(bool b) {
+    Value v;
+    v.type = Value::BOOL;
+    v.boolVal = b;
+    return v;
+}
+
+inline Value num(double n) {
+    Value v;
+    v.type = Value::NUMBER;
+    v.numVal = n;
+    return v;
+}
+
+inline Value str(std::string s) {
+    Value v;
+    v.type = Value::STRING;
+    v.strVal = std::move(s);
+    return v;
+}
+
+inline Value list(List items) {
+    Value v;
+    v.type = Value::LIST;
+    v.listVal = std::make_shared<List>(std::move(items));
+    return v;
+}
+
+// Erro fatal: equivale a uma exceção não tratada na VM em Python
+[[noreturn]] inline void fatal(const char* msg) {
+    console.flush();
+    std::fprintf(stderr, "%s\n", msg);
+    std::exit(1);
+}
+
+inline void message(const char* msg) {
+    console.write(msg);
+    console.write("\n", 1);
+}
+
+// -------------------- Conversão para texto --------------------
+
+inline void appendNumber(std::string& out, double d) {
+    if (std::isnan(d)) {   // Python nunca escreve "-nan"
+        out += "nan";
+        return;
+    }
+    char buf[32];
+    auto r = std::to_chars(buf, buf + sizeof buf, d, std::chars_format::general, 15);
+    out.append(buf, r.ptr);
+}
+
+inline void appendString(std::string& out, const Value& v) {
+    switch (v.type) {
+    case Value::BOOL:
+        out += v.boolVal ? "Verdadeiro" : "Falso";
+        break;
+    case Value::NUMBER:
+        appendNumber(out, v.numVal);
+        break;
+    case Value::STRING:
+        out += v.strVal;
+        break;
+    case Value::LIST:
+        if (!v.listVal || v.listVal->empty()) {
+            out += "[]";
+            break;
+        }
+        out += '[';
+        for (size_t i = 0; i < v.listVal->size(); ++i) {
+            if (i > 0) out += ", ";
+            appendString(out, (*v.listVal)[i]);
+        }
+        out += ']';
+        break;
+    default:
+        out += "Nulo";
+        break;
+    }
+}
+
+inline std::string toString(const Value& v) {
+    if (v.type == Value::STRING) return v.strVal;
+    std::string s;
+    appendString(s, v);
+    return s;
+}
+
+inline bool truthy(const Value& v) {
+    switch (v.type) {
+    case Value::BOOL:   return v.boolVal;
+    case Value::NUMBER: return v.numVal != 0.0;
+    case Value::STRING: return !v.strVal.empty() && v.strVal != "Falso" && v.strVal != "Nao";
+    case Value::LIST:   return v.listVal && !v.listVal->empty();
+    default:            return false;
+    }
+}
+
+// -------------------- Operações --------------------
+
+inline Value add(const Value& a, const Value& b) {
+    if (a.type == Value::STRING || b.type == Value::STRING) {
+        std::string s;
+        appendString(s, a);
+        appendString(s, b);
+        return str(std::move(s));
+    }
+    return num(a.numVal + b.numVal);
+}
+
+inline Value sub(const Value& a, const Value& b) { return num(a.numVal - b.numVal); }
+inline Value mul(const Value& a, const Value& b) { return num(a.numVal * b.numVal); }
+
+inline Value div(const Value& a, const Value& b) {
+    if (b.numVal == 0.0) {
+        message("[VM] Divisão por zero");
+        return num(0.0);
+    }
+    return num(a.numVal / b.numVal);
+}
+
+// math.fmod: resultado NaN sem operando NaN é erro de domínio
+inline Value mod(const Value& a, const Value& b) {
+    if (std::isinf(b.numVal) && std::isfinite(a.numVal)) return num(a.numVal);
+    double r = std::fmod(a.numVal, b.numVal);
+    if (std::isnan(r) && !std::isnan(a.numVal) && !std::isnan(b.numVal)) {
+        fatal("ValueError: math domain error");
+    }
+    return num(r);
+}
+
+inline bool equals(const Value& a, const Value& b) {
+    if (a.type == Value::NUMBER && b.type == Value::NUMBER) {
+        return std::fabs(a.numVal - b.numVal) < 1e-9;
+    }
+    if (a.type == Value::STRING && b.type == Value::STRING) return a.strVal == b.strVal;
+    return toString(a) == toString(b);
+}
+
+inline Value eq(const Value& a, const Value& b)  { return boolean(equals(a, b)); }
+inline Value neq(const Value& a, const Value& b) { return boolean(!equals(a, b)); }
+inline Value lt(const Value& a, const Value& b)  { return boolean(a.numVal < b.numVal); }
+inline Value lte(const Value& a, const Value& b) { return boolean(a.numVal <= b.numVal); }
+inline Value gt(const Value& a, const Value& b)  { return boolean(a.numVal > b.numVal); }
+inline Value gte(const Value& a, const Value& b) { return boolean(a.numVal >= b.numVal); }
+
+inline Value logicalAnd(const Value& a, const Value& b) { return boolean(truthy(a) && truthy(b)); }
+inline Value logicalOr(const Value& a, const Value& b)  { return boolean(truthy(a) || truthy(b)); }
+
+// Tamanho de string em caracteres (code points UTF-8), como len() do Python
+inline Value len(const Value& v) {
+    if (v.type == Value::LIST && v.listVal) return num((double)v.listVal->size());
+    if (v.type == Value::STRING) {
+        size_t n = 0;
+        for (unsigned char c : v.strVal) n += (c & 0xC0) != 0x80;
+        return num((double)n);
+    }
+    return num(0.0);
+}
+
+// -------------------- Listas --------------------
+
+// int() do Python: trunca; NaN e infinito abortam
+inline long long toIndex(double d) {
+    if (std::isnan(d)) fatal("ValueError: cannot convert float NaN to integer");
+    if (std::isinf(d)) fatal("OverflowError: cannot convert float infinity to integer");
+    d = std::trunc(d);
+    if (d < -9.0e18 || d > 9.0e18) return -1;  // fora de qualquer lista
+    return (long long)d;
+}
+
+inline Value index(const Value& l, const Value& i) {
+    if (l.type != Value::LIST || !l.listVal) {
+        message("[VM] INDEX aplicado em não-lista");
+        return nil();
+    }
+    long long idx = toIndex(i.numVal);
+    if (idx < 0 || idx >= (long long)l.listVal->size()) {
+        message("[VM] INDEX índice fora do intervalo");
+        return nil();
+    }
+    return (*l.listVal)[idx];
+}
+
+// O valor é recebido por cópia: pode ser a própria variável (@l << @l)
+inline void append(Value& target, Value v) {
+    if (target.type != Value::LIST || !target.listVal) target = list({});
+    target.listVal->push_back(std::move(v));
+}
+
+inline void storeIndex(Value& target, const Value& i, Value v, const char* name) {
+    long long idx = toIndex(i.numVal);
+    if (target.type != Value::LIST || !target.listVal) {
+        message((std::string("[VM] STORE_INDEX em variável não-lista: ") + name).c_str());
+    } else if (idx < 0 || idx >= (long long)target.listVal->size()) {
+        message("[VM] STORE_INDEX índice fora do intervalo");
+    } else {
+        (*target.listVal)[idx] = std::move(v);
+    }
+}
+
+// -------------------- Saída --------------------
+
+inline void print(const char* prefix, const Value& v) {
+    std::string line = prefix;
+    appendString(line, v);
+    line += '\n';
+    console.write(line);
+}
+
+// -------------------- Entrada --------------------
+
+// Tamanho do caractere de espaço (critério de str.strip()) que começa em s
+inline size_t spaceAt(std::string_view s) {
+    if (s.empty()) return 0;
+    unsigned char c = s[0];
+    if (c == ' ' || (c >= '\t' && c <= '\r') || (c >= 0x1C && c <= 0x1F)) return 1;
+    if (s.size() >= 2 && c == 0xC2 && ((unsigned char)s[1] == 0x85 || (unsigned char)s[1] == 0xA0)) return 2;
+    if (s.size() >= 3) {
+        std::string_view t = s.substr(0, 3);
+        if (t == "\xE1\x9A\x80" || t == "\xE2\x80\xA8" || t == "\xE2\x80\xA9" || t == "\xE2\x80\xAF"
+            || t == "\xE2\x81\x9F" || t == "\xE3\x80\x80") return 3;
+        if (c == 0xE2 && (unsigned char)s[1] == 0x80
+            && (unsigned char)s[2] >= 0x80 && (unsigned char)s[2] <= 0x8A) return 3;
+    }
+    return 0;
+}
+
+inline std::string_view strip(std::string_view s) {
+    while (size_t n = spaceAt(s)) s.remove_prefix(n);
+    for (bool again = true; again && !s.empty();) {
+        again = false;
+        for (size_t n = 1; n <= 3 && n <= s.size(); ++n) {
+            if (spaceAt(s.substr(s.size() - n)) == n) {
+                s.remove_suffix(n);
+                again = true;
+                break;
+            }
+        }
+    }
+    return s;
+}
+
+// repr() de um float do Python (menor representação que volta ao mesmo double)
+inline std::string pyRepr(double d) {
+    if (std::isnan(d)) return "nan";
+    if (std::isinf(d)) return d < 0 ? "-inf" : "inf";
+
+    char buf[40];
+    auto r = std::to_chars(buf, buf + sizeof buf, d, std::chars_format::scientific);
+    std::string_view sci(buf, r.ptr - buf);
+
+    std::string out;
+    if (sci[0] == '-') {
+        out += '-';
+        sci.remove_prefix(1);
+    }
+    size_t e = sci.find('e');
+    std::string digits;
+    for (char c : sci.substr(0, e)) {
+        if (c != '.') digits += c;
+    }
+    int exp = std::atoi(std::string(sci.substr(e + 1)).c_str());
+    int decpt = exp + 1;
+    int n = (int)digits.size();
+
+    if (decpt > -4 && decpt <= 16) {
+        if (decpt <= 0) {
+            out += "0." + std::string(-decpt, '0') + digits;
+        } else if (decpt >= n) {
+            out += digits + std::string(decpt - n, '0') + ".0";
+        } else {
+            out += digits.substr(0, decpt) + "." + digits.substr(decpt);
+        }
+    } else {
+        out += digits[0];
+        if (n > 1) out += "." + digits.substr(1);
+        out += exp < 0 ? "e-" : "e+";
+        std::string mag = std::to_string(exp < 0 ? -exp : exp);
+        if (mag.size() < 2) out += '0';
+        out += mag;
+    }
+    return out;
+}
+
+// "[0-9]*.?[0-9]*" com ao menos um dígito (o teste isdigit() da VM)
+inline bool isPlainDecimal(std::string_view s) {
+    bool digit = false, dot = false;
+    for (char c : s) {
+        if (c >= '0' && c <= '9') digit = true;
+        else if (c == '.' && !dot) dot = true;
+        else return false;
+    }
+    return digit;
+}
+
+// Mesmas regras do INPUT da VM: número se float() aceita a linha e ela é
+// exatamente o repr() do número ou só dígitos com um ponto; senão
+// Verdadeiro/Sim, Falso/Nao ou string. Linha vazia ou fim da entrada: Nulo.
+inline Value parseInput(std::string_view line) {
+    if (line.empty()) return nil();
+    std::string text(line);
+    if (isPlainDecimal(line)) return num(std::strtod(text.c_str(), nullptr));
+
+    char* end = nullptr;
+    double d = std::strtod(text.c_str(), &end);
+    if (end == text.c_str() + text.size() && pyRepr(d) == text) return num(d);
+
+    if (line == "Verdadeiro" || line == "Sim") return boolean(true);
+    if (line == "Falso" || line == "Nao") return boolean(false);
+    return str(std::move(text));
+}
+
+inline void input(Value& target) {
+    console.write("> ", 2);
+
+    // Como input(): fim de linha em "\n", "\r\n" ou "\r"
+    std::string line;
+    target = console.readLine(line, true) ? parseInput(strip(line)) : nil();
+}
+
+} // namespace rt
+
+#endif
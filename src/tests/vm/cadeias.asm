@@ -0,0 +1,505 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/cadeias.ms
+.SOURCE_HASH 19494789b35a83fa
+
+.STACK 3
+.SLOTS 6
+.SYM 0 @sep
+.SYM 1 @frase
+.SYM 2 @n
+.SYM 3 @soma
+.SYM 4 @i
+.SYM 5 @total
+
+PUSH_STR " "
+STORE_SLOT 0
+PUSH_STR "Apenas"
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "Apenas"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "Apenas"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "Apenas"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "Apenas"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "Apenas"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "Apenas"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "Apenas"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "que"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "nada"
+ADD
+LOAD_SLOT 0
+ADD
+PUSH_STR "sei"
+ADD
+STORE_SLOT 1
+LOAD_SLOT 1
+LEN
+PRINT
+LOAD_SLOT 1
+PRINT
+PUSH_NUM 1
+STORE_SLOT 2
+PUSH_NUM 0
+LOAD_SLOT 2
+ADD
+PUSH_NUM 2
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 4
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 6
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 8
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 10
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 12
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 14
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 16
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 18
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 20
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 22
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 24
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 26
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 28
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 30
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 32
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 34
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 36
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 38
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 40
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 42
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 44
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 46
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 48
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 50
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 52
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 54
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 56
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 58
+ADD
+LOAD_SLOT 2
+ADD
+STORE_SLOT 3
+LOAD_SLOT 3
+PRINT
+PUSH_NUM 0
+STORE_SLOT 4
+PUSH_NUM 0
+STORE_SLOT 5
+LABEL L_unroll_0
+LOAD_SLOT 4
+PUSH_NUM 3
+ADD
+PUSH_NUM 4
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while0.body
+LOAD_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 2
+MUL
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+LOAD_SLOT 4
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+PUSH_NUM 2
+ADD
+ADD
+LOAD_SLOT 2
+SUB
+PUSH_NUM 1
+SUB
+LOAD_SLOT 4
+PUSH_NUM 2
+MOD
+ADD
+STORE_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+.SITE while0.body
+LOAD_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 2
+MUL
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+LOAD_SLOT 4
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+PUSH_NUM 2
+ADD
+ADD
+LOAD_SLOT 2
+SUB
+PUSH_NUM 1
+SUB
+LOAD_SLOT 4
+PUSH_NUM 2
+MOD
+ADD
+STORE_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+.SITE while0.body
+LOAD_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 2
+MUL
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+LOAD_SLOT 4
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+PUSH_NUM 2
+ADD
+ADD
+LOAD_SLOT 2
+SUB
+PUSH_NUM 1
+SUB
+LOAD_SLOT 4
+PUSH_NUM 2
+MOD
+ADD
+STORE_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+.SITE while0.body
+LOAD_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 2
+MUL
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+LOAD_SLOT 4
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+PUSH_NUM 2
+ADD
+ADD
+LOAD_SLOT 2
+SUB
+PUSH_NUM 1
+SUB
+LOAD_SLOT 4
+PUSH_NUM 2
+MOD
+ADD
+STORE_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 4
+PUSH_NUM 4
+CMP_LT
+.SITE while0
+JUMP_IF_FALSE L_end_while_0
+.SITE while0.body
+LOAD_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 2
+MUL
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+LOAD_SLOT 4
+LOAD_SLOT 2
+ADD
+PUSH_NUM 1
+ADD
+PUSH_NUM 2
+ADD
+ADD
+LOAD_SLOT 2
+SUB
+PUSH_NUM 1
+SUB
+LOAD_SLOT 4
+PUSH_NUM 2
+MOD
+ADD
+STORE_SLOT 5
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+JUMP L_while_0
+LABEL L_end_while_0
+LOAD_SLOT 5
+PRINT
+LOAD_SLOT 3
+PUSH_NUM 0
+CMP_GT
+LOAD_SLOT 5
+PUSH_NUM 0
+CMP_GT
+AND
+LOAD_SLOT 4
+PUSH_NUM 4
+CMP_EQ
+AND
+LOAD_SLOT 2
+PUSH_NUM 2
+CMP_LT
+AND
+LOAD_SLOT 1
+PUSH_STR ""
+CMP_NEQ
+AND
+.SITE if1
+JUMP_IF_FALSE L_end_if_1
+PUSH_STR "Cadeias avaliadas."
+PRINT_CONCL
+LABEL L_end_if_1
+
+HALT
@@ -1,12 +1,18 @@
 ; Arquivo gerado pelo compilador Maiêutic
 ; Fonte: ../tests/compiler/condicional.ms
+.SOURCE_HASH abd6dcd5002c1f8f
+
+.STACK 2
+.SLOTS 1
+.SYM 0 @idade
 
 PUSH_STR "Digite sua idade:"
 QUESTION
-INPUT @idade
-LOAD @idade
+INPUT_SLOT 0
+LOAD_SLOT 0
 PUSH_NUM 18
 CMP_GTE
+.SITE if0
 JUMP_IF_FALSE L_else_0
 PUSH_STR "Você é maior de idade."
 PRINT_CONCL
@@ -0,0 +1,189 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/desenrolamento.ms
+.SOURCE_HASH b94f21569f304331
+
+.STACK 2
+.SLOTS 4
+.SYM 0 @i
+.SYM 1 @soma
+.SYM 2 @pares
+.SYM 3 @k
+
+PUSH_NUM 0
+STORE_SLOT 0
+PUSH_NUM 0
+STORE_SLOT 1
+LABEL L_unroll_0
+LOAD_SLOT 0
+PUSH_NUM 3
+ADD
+PUSH_NUM 10
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+ADD
+STORE_SLOT 1
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+ADD
+STORE_SLOT 1
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+ADD
+STORE_SLOT 1
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+ADD
+STORE_SLOT 1
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 0
+PUSH_NUM 10
+CMP_LT
+.SITE while0
+JUMP_IF_FALSE L_end_while_0
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+ADD
+STORE_SLOT 1
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+JUMP L_while_0
+LABEL L_end_while_0
+PUSH_STR "Soma de 0 a 9: "
+LOAD_SLOT 1
+ADD
+PRINT
+BUILD_LIST 0
+STORE_SLOT 2
+PUSH_NUM 9
+STORE_SLOT 3
+LABEL L_unroll_1
+LOAD_SLOT 3
+PUSH_NUM 9
+SUB
+PUSH_NUM 0
+CMP_GTE
+JUMP_IF_FALSE L_while_1
+.SITE while2.body
+LOAD_SLOT 3
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if1
+JUMP_IF_FALSE L_end_if_2
+LOAD_SLOT 3
+APPEND_SLOT 2
+LABEL L_end_if_2
+LOAD_SLOT 3
+PUSH_NUM 3
+SUB
+STORE_SLOT 3
+.SITE while2.body
+LOAD_SLOT 3
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if1
+JUMP_IF_FALSE L_end_if_3
+LOAD_SLOT 3
+APPEND_SLOT 2
+LABEL L_end_if_3
+LOAD_SLOT 3
+PUSH_NUM 3
+SUB
+STORE_SLOT 3
+.SITE while2.body
+LOAD_SLOT 3
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if1
+JUMP_IF_FALSE L_end_if_4
+LOAD_SLOT 3
+APPEND_SLOT 2
+LABEL L_end_if_4
+LOAD_SLOT 3
+PUSH_NUM 3
+SUB
+STORE_SLOT 3
+.SITE while2.body
+LOAD_SLOT 3
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if1
+JUMP_IF_FALSE L_end_if_5
+LOAD_SLOT 3
+APPEND_SLOT 2
+LABEL L_end_if_5
+LOAD_SLOT 3
+PUSH_NUM 3
+SUB
+STORE_SLOT 3
+JUMP L_unroll_1
+LABEL L_while_1
+LOAD_SLOT 3
+PUSH_NUM 0
+CMP_GTE
+.SITE while2
+JUMP_IF_FALSE L_end_while_1
+.SITE while2.body
+LOAD_SLOT 3
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if1
+JUMP_IF_FALSE L_end_if_6
+LOAD_SLOT 3
+APPEND_SLOT 2
+LABEL L_end_if_6
+LOAD_SLOT 3
+PUSH_NUM 3
+SUB
+STORE_SLOT 3
+JUMP L_while_1
+LABEL L_end_while_1
+PUSH_STR "Pares encontrados: "
+LOAD_SLOT 2
+ADD
+PRINT
+PUSH_STR "Fim: i = "
+LOAD_SLOT 0
+ADD
+PUSH_STR ", k = "
+ADD
+LOAD_SLOT 3
+ADD
+PRINT_CONCL
+
+HALT
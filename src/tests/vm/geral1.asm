@@ -1,37 +1,45 @@
 ; Arquivo gerado pelo compilador Maiêutic
 ; Fonte: ../tests/compiler/geral1.ms
+.SOURCE_HASH 4adc9ed12c87ef17
+
+.STACK 3
+.SLOTS 2
+.SYM 0 @lista
+.SYM 1 @x
 
 PUSH_NUM 10
 PUSH_NUM 20
 PUSH_NUM 30
 BUILD_LIST 3
-STORE @lista
+STORE_SLOT 0
 PUSH_STR "Tamanho inicial: "
-LOAD @lista
+LOAD_SLOT 0
 LEN
 ADD
 PRINT
 PUSH_NUM 40
-APPEND @lista
+APPEND_SLOT 0
 PUSH_NUM 0
 PUSH_NUM 999
-STORE_INDEX @lista
+STORE_INDEX_SLOT 0
 PUSH_STR "Lista modificada: "
-LOAD @lista
+LOAD_SLOT 0
 ADD
 PRINT
 PUSH_STR "Digite um numero:"
 QUESTION
-INPUT @x
-LOAD @x
+INPUT_SLOT 1
+LOAD_SLOT 1
 PUSH_NUM 10
 CMP_GT
+.SITE if1
 JUMP_IF_FALSE L_else_0
 PUSH_STR "Maior que 10"
 PRINT
-LOAD @x
+LOAD_SLOT 1
 PUSH_NUM 100
 CMP_GT
+.SITE if0
 JUMP_IF_FALSE L_end_if_1
 PUSH_STR "Gigante!"
 PRINT
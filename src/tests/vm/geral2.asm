@@ -1,43 +1,60 @@
 ; Arquivo gerado pelo compilador Maiêutic
 ; Fonte: ../tests/compiler/geral2.ms
+.SOURCE_HASH 6ba04437f05f87a9
+
+.STACK 3
+.SLOTS 13
+.SYM 0 @inteiro
+.SYM 1 @float
+.SYM 2 @string
+.SYM 3 @bool
+.SYM 4 @lista_vazia
+.SYM 5 @lista_mista
+.SYM 6 @item
+.SYM 7 @calculo
+.SYM 8 @parenteses
+.SYM 9 @teste_logico
+.SYM 10 @input_user
+.SYM 11 @contador
+.SYM 12 @tamanho
 
 PUSH_NUM 42
-STORE @inteiro
+STORE_SLOT 0
 PUSH_NUM 3.14
-STORE @float
+STORE_SLOT 1
 PUSH_STR "Texto com espaços e símbolos!"
-STORE @string
+STORE_SLOT 2
 PUSH_BOOL 0
-STORE @bool
+STORE_SLOT 3
 BUILD_LIST 0
-STORE @lista_vazia
+STORE_SLOT 4
 PUSH_NUM 1
 PUSH_STR "Dois"
 PUSH_BOOL 1
 BUILD_LIST 3
-STORE @lista_mista
-LOAD @lista_mista
+STORE_SLOT 5
+LOAD_SLOT 5
 PUSH_NUM 1
 INDEX
-STORE @item
+STORE_SLOT 6
 PUSH_NUM 100
-APPEND @lista_vazia
-LOAD @inteiro
+APPEND_SLOT 4
+LOAD_SLOT 0
 PUSH_NUM 2
 MUL
-APPEND @lista_vazia
-LOAD @inteiro
+APPEND_SLOT 4
+LOAD_SLOT 0
 PUSH_NUM 10
 PUSH_NUM 2
 MUL
 ADD
-STORE @calculo
-LOAD @inteiro
+STORE_SLOT 7
+LOAD_SLOT 0
 PUSH_NUM 10
 ADD
 PUSH_NUM 2
 MUL
-STORE @parenteses
+STORE_SLOT 8
 PUSH_NUM 5
 PUSH_NUM 2
 CMP_GT
@@ -45,42 +62,122 @@ PUSH_NUM 10
 PUSH_NUM 11
 CMP_NEQ
 AND
-LOAD @bool
+LOAD_SLOT 3
 PUSH_BOOL 1
 CMP_EQ
 OR
-STORE @teste_logico
+STORE_SLOT 9
 PUSH_STR "Início do teste de fluxo. Digite 1:"
 QUESTION
-INPUT @input_user
-LOAD @input_user
+INPUT_SLOT 10
+LOAD_SLOT 10
 PUSH_NUM 1
 CMP_EQ
+.SITE if2
 JUMP_IF_FALSE L_else_0
 PUSH_STR "Nível 1 OK"
 PRINT
 PUSH_NUM 0
-STORE @contador
-LABEL L_while_1
-LOAD @contador
+STORE_SLOT 11
+LABEL L_unroll_1
+LOAD_SLOT 11
+PUSH_NUM 3
+ADD
 PUSH_NUM 2
 CMP_LT
-JUMP_IF_FALSE L_end_while_1
+JUMP_IF_FALSE L_while_1
+.SITE while1.body
 PUSH_STR "  Nível 2 (Loop): "
-LOAD @contador
+LOAD_SLOT 11
 ADD
 PRINT
-LOAD @contador
+LOAD_SLOT 11
 PUSH_NUM 1
 CMP_EQ
+.SITE if0
 JUMP_IF_FALSE L_end_if_2
 PUSH_STR "    Nível 3 (Branch interno)"
 PRINT
 LABEL L_end_if_2
-LOAD @contador
+LOAD_SLOT 11
+PUSH_NUM 1
+ADD
+STORE_SLOT 11
+.SITE while1.body
+PUSH_STR "  Nível 2 (Loop): "
+LOAD_SLOT 11
+ADD
+PRINT
+LOAD_SLOT 11
+PUSH_NUM 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_3
+PUSH_STR "    Nível 3 (Branch interno)"
+PRINT
+LABEL L_end_if_3
+LOAD_SLOT 11
+PUSH_NUM 1
+ADD
+STORE_SLOT 11
+.SITE while1.body
+PUSH_STR "  Nível 2 (Loop): "
+LOAD_SLOT 11
+ADD
+PRINT
+LOAD_SLOT 11
+PUSH_NUM 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_4
+PUSH_STR "    Nível 3 (Branch interno)"
+PRINT
+LABEL L_end_if_4
+LOAD_SLOT 11
+PUSH_NUM 1
+ADD
+STORE_SLOT 11
+.SITE while1.body
+PUSH_STR "  Nível 2 (Loop): "
+LOAD_SLOT 11
+ADD
+PRINT
+LOAD_SLOT 11
+PUSH_NUM 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_5
+PUSH_STR "    Nível 3 (Branch interno)"
+PRINT
+LABEL L_end_if_5
+LOAD_SLOT 11
+PUSH_NUM 1
+ADD
+STORE_SLOT 11
+JUMP L_unroll_1
+LABEL L_while_1
+LOAD_SLOT 11
+PUSH_NUM 2
+CMP_LT
+.SITE while1
+JUMP_IF_FALSE L_end_while_1
+.SITE while1.body
+PUSH_STR "  Nível 2 (Loop): "
+LOAD_SLOT 11
+ADD
+PRINT
+LOAD_SLOT 11
+PUSH_NUM 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_6
+PUSH_STR "    Nível 3 (Branch interno)"
+PRINT
+LABEL L_end_if_6
+LOAD_SLOT 11
 PUSH_NUM 1
 ADD
-STORE @contador
+STORE_SLOT 11
 JUMP L_while_1
 LABEL L_end_while_1
 JUMP L_end_if_0
@@ -88,11 +185,11 @@ LABEL L_else_0
 PUSH_STR "Erro no teste de fluxo."
 PRINT_CONCL
 LABEL L_end_if_0
-LOAD @lista_mista
+LOAD_SLOT 5
 LEN
-STORE @tamanho
+STORE_SLOT 12
 PUSH_STR "Teste finalizado. Tamanho da lista: "
-LOAD @tamanho
+LOAD_SLOT 12
 ADD
 PRINT_CONCL
 
@@ -0,0 +1,365 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/importar.ms
+; Módulo: ../tests/compiler/modulos/perguntas.ms
+; Módulo: ../tests/compiler/modulos/saudacao.ms
+; Módulo: ../tests/compiler/modulos/placar.ms
+
+.SOURCE_HASH 91257be30dc0bee5
+.STACK 2
+.SLOTS 9
+.SYM 0 @tema
+.SYM 1 @perguntas
+.SYM 2 @i
+.SYM 3 @acertos
+.SYM 4 @resposta
+.SYM 5 @respostas
+.SYM 6 @certa
+.SYM 7 @estrelas
+.SYM 8 @k
+
+PUSH_STR "Filosofia"
+STORE_SLOT 0
+; Importar ../tests/compiler/modulos/perguntas.ms
+; Importar ../tests/compiler/modulos/saudacao.ms
+PUSH_STR "Bem-vindo ao diálogo sobre "
+LOAD_SLOT 0
+ADD
+PRINT
+PUSH_STR "Quem escreveu A República?"
+PUSH_STR "Qual é o método de Sócrates?"
+BUILD_LIST 2
+STORE_SLOT 1
+PUSH_STR "Platão"
+PUSH_STR "Maiêutica"
+BUILD_LIST 2
+STORE_SLOT 5
+PUSH_STR "Perguntas: "
+LOAD_SLOT 1
+LEN
+ADD
+PRINT
+PUSH_NUM 0
+STORE_SLOT 2
+PUSH_NUM 0
+STORE_SLOT 3
+LOAD_SLOT 1
+LEN
+MOV_TOP_R0
+LABEL L_unroll_0
+LOAD_SLOT 2
+PUSH_NUM 3
+ADD
+PUSH_R0
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while1.body
+LOAD_SLOT 1
+LOAD_SLOT 2
+INDEX
+QUESTION
+INPUT_SLOT 4
+LOAD_SLOT 5
+LOAD_SLOT 2
+INDEX
+STORE_SLOT 6
+LOAD_SLOT 4
+LOAD_SLOT 6
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_1
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+LABEL L_end_if_1
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+.SITE while1.body
+LOAD_SLOT 1
+LOAD_SLOT 2
+INDEX
+QUESTION
+INPUT_SLOT 4
+LOAD_SLOT 5
+LOAD_SLOT 2
+INDEX
+STORE_SLOT 6
+LOAD_SLOT 4
+LOAD_SLOT 6
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_2
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+LABEL L_end_if_2
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+.SITE while1.body
+LOAD_SLOT 1
+LOAD_SLOT 2
+INDEX
+QUESTION
+INPUT_SLOT 4
+LOAD_SLOT 5
+LOAD_SLOT 2
+INDEX
+STORE_SLOT 6
+LOAD_SLOT 4
+LOAD_SLOT 6
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_3
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+LABEL L_end_if_3
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+.SITE while1.body
+LOAD_SLOT 1
+LOAD_SLOT 2
+INDEX
+QUESTION
+INPUT_SLOT 4
+LOAD_SLOT 5
+LOAD_SLOT 2
+INDEX
+STORE_SLOT 6
+LOAD_SLOT 4
+LOAD_SLOT 6
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_4
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+LABEL L_end_if_4
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 2
+PUSH_R0
+CMP_LT
+.SITE while1
+JUMP_IF_FALSE L_end_while_0
+.SITE while1.body
+LOAD_SLOT 1
+LOAD_SLOT 2
+INDEX
+QUESTION
+INPUT_SLOT 4
+LOAD_SLOT 5
+LOAD_SLOT 2
+INDEX
+STORE_SLOT 6
+LOAD_SLOT 4
+LOAD_SLOT 6
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_end_if_5
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+LABEL L_end_if_5
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+JUMP L_while_0
+LABEL L_end_while_0
+; Importar ../tests/compiler/modulos/placar.ms
+PUSH_STR ""
+STORE_SLOT 7
+PUSH_NUM 0
+STORE_SLOT 8
+LABEL placar1.L_unroll_0
+LOAD_SLOT 8
+PUSH_NUM 3
+ADD
+LOAD_SLOT 3
+CMP_LT
+JUMP_IF_FALSE placar1.L_while_0
+.SITE placar1.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+.SITE placar1.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+.SITE placar1.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+.SITE placar1.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+JUMP placar1.L_unroll_0
+LABEL placar1.L_while_0
+LOAD_SLOT 8
+LOAD_SLOT 3
+CMP_LT
+.SITE placar1.while0
+JUMP_IF_FALSE placar1.L_end_while_0
+.SITE placar1.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+JUMP placar1.L_while_0
+LABEL placar1.L_end_while_0
+LOAD_SLOT 3
+LOAD_SLOT 1
+LEN
+CMP_GTE
+.SITE placar1.if1
+JUMP_IF_FALSE placar1.L_else_1
+PUSH_STR "Gabaritou! "
+LOAD_SLOT 7
+ADD
+PRINT_CONCL
+JUMP placar1.L_end_if_1
+LABEL placar1.L_else_1
+PUSH_STR "Acertos: "
+LOAD_SLOT 3
+ADD
+PUSH_STR " "
+ADD
+LOAD_SLOT 7
+ADD
+PRINT
+LABEL placar1.L_end_if_1
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+; Importar ../tests/compiler/modulos/placar.ms
+PUSH_STR ""
+STORE_SLOT 7
+PUSH_NUM 0
+STORE_SLOT 8
+LABEL placar2.L_unroll_0
+LOAD_SLOT 8
+PUSH_NUM 3
+ADD
+LOAD_SLOT 3
+CMP_LT
+JUMP_IF_FALSE placar2.L_while_0
+.SITE placar2.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+.SITE placar2.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+.SITE placar2.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+.SITE placar2.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+JUMP placar2.L_unroll_0
+LABEL placar2.L_while_0
+LOAD_SLOT 8
+LOAD_SLOT 3
+CMP_LT
+.SITE placar2.while0
+JUMP_IF_FALSE placar2.L_end_while_0
+.SITE placar2.while0.body
+LOAD_SLOT 7
+PUSH_STR "*"
+ADD
+STORE_SLOT 7
+LOAD_SLOT 8
+PUSH_NUM 1
+ADD
+STORE_SLOT 8
+JUMP placar2.L_while_0
+LABEL placar2.L_end_while_0
+LOAD_SLOT 3
+LOAD_SLOT 1
+LEN
+CMP_GTE
+.SITE placar2.if1
+JUMP_IF_FALSE placar2.L_else_1
+PUSH_STR "Gabaritou! "
+LOAD_SLOT 7
+ADD
+PRINT_CONCL
+JUMP placar2.L_end_if_1
+LABEL placar2.L_else_1
+PUSH_STR "Acertos: "
+LOAD_SLOT 3
+ADD
+PUSH_STR " "
+ADD
+LOAD_SLOT 7
+ADD
+PRINT
+LABEL placar2.L_end_if_1
+PUSH_STR "Fim do teste de módulos."
+PRINT_CONCL
+
+HALT
@@ -1,11 +1,16 @@
 ; Arquivo gerado pelo compilador Maiêutic
 ; Fonte: ../tests/compiler/input.ms
+.SOURCE_HASH b44b37a95a416725
+
+.STACK 2
+.SLOTS 1
+.SYM 0 @nome
 
 PUSH_STR "Qual o seu nome?"
 QUESTION
-INPUT @nome
+INPUT_SLOT 0
 PUSH_STR "Olá, "
-LOAD @nome
+LOAD_SLOT 0
 ADD
 PRINT
 PUSH_STR "Fim do teste de input."
@@ -0,0 +1,86 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/invariante.ms
+.SOURCE_HASH f1cc95aa698f6a85
+
+.STACK 3
+.SLOTS 5
+.SYM 0 @n
+.SYM 1 @i
+.SYM 2 @j
+.SYM 3 %r2
+.SYM 4 %r3
+
+PUSH_NUM 3
+STORE_SLOT 0
+PUSH_NUM 0
+STORE_SLOT 1
+PUSH_NUM 0
+STORE_SLOT 2
+LOAD_SLOT 0
+PUSH_NUM 2
+MUL
+MOV_TOP_R0
+PUSH_NUM 0
+LOAD_SLOT 0
+SUB
+MOV_TOP_R1
+LOAD_SLOT 0
+LOAD_SLOT 0
+ADD
+PUSH_NUM 1
+SUB
+STORE_SLOT 3
+LABEL L_while_0
+LOAD_SLOT 1
+PUSH_R0
+CMP_LT
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+PUSH_R1
+CMP_GTE
+AND
+.SITE while1
+JUMP_IF_FALSE L_end_while_0
+.SITE while1.body
+LOAD_SLOT 1
+LOAD_SLOT 1
+SUB
+PUSH_NUM 0
+CMP_EQ
+STORE_SLOT 4
+LABEL L_while_1
+LOAD_SLOT 2
+LOAD_SLOT 3
+CMP_LT
+LOAD_SLOT 4
+AND
+.SITE while0
+JUMP_IF_FALSE L_end_while_1
+.SITE while0.body
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+JUMP L_while_1
+LABEL L_end_while_1
+PUSH_STR "i = "
+LOAD_SLOT 1
+ADD
+PUSH_STR ", j = "
+ADD
+LOAD_SLOT 2
+ADD
+PRINT
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+JUMP L_while_0
+LABEL L_end_while_0
+PUSH_STR "Fim: "
+LOAD_SLOT 1
+ADD
+PRINT_CONCL
+
+HALT
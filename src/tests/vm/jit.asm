@@ -0,0 +1,419 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/jit.ms
+.SOURCE_HASH ee2b0ecd651bb5f5
+
+.STACK 3
+.SLOTS 10
+.SYM 0 @n
+.SYM 1 @i
+.SYM 2 @soma
+.SYM 3 @pares
+.SYM 4 @resto
+.SYM 5 @x
+.SYM 6 @passos
+.SYM 7 @a
+.SYM 8 @z
+.SYM 9 @b
+
+PUSH_NUM 2000
+STORE_SLOT 0
+PUSH_NUM 0
+STORE_SLOT 1
+PUSH_NUM 0
+STORE_SLOT 2
+PUSH_NUM 0
+STORE_SLOT 3
+PUSH_NUM 0
+STORE_SLOT 4
+LABEL L_unroll_0
+LOAD_SLOT 1
+PUSH_NUM 3
+ADD
+LOAD_SLOT 0
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while1.body
+LOAD_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 3
+MUL
+ADD
+LOAD_SLOT 1
+PUSH_NUM 2
+DIV
+SUB
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+LOAD_SLOT 1
+PUSH_NUM 10
+CMP_NEQ
+AND
+.SITE if0
+JUMP_IF_FALSE L_else_1
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+JUMP L_end_if_1
+LABEL L_else_1
+LOAD_SLOT 4
+LOAD_SLOT 1
+PUSH_NUM 7
+MOD
+ADD
+STORE_SLOT 4
+LABEL L_end_if_1
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+.SITE while1.body
+LOAD_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 3
+MUL
+ADD
+LOAD_SLOT 1
+PUSH_NUM 2
+DIV
+SUB
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+LOAD_SLOT 1
+PUSH_NUM 10
+CMP_NEQ
+AND
+.SITE if0
+JUMP_IF_FALSE L_else_2
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+JUMP L_end_if_2
+LABEL L_else_2
+LOAD_SLOT 4
+LOAD_SLOT 1
+PUSH_NUM 7
+MOD
+ADD
+STORE_SLOT 4
+LABEL L_end_if_2
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+.SITE while1.body
+LOAD_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 3
+MUL
+ADD
+LOAD_SLOT 1
+PUSH_NUM 2
+DIV
+SUB
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+LOAD_SLOT 1
+PUSH_NUM 10
+CMP_NEQ
+AND
+.SITE if0
+JUMP_IF_FALSE L_else_3
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+JUMP L_end_if_3
+LABEL L_else_3
+LOAD_SLOT 4
+LOAD_SLOT 1
+PUSH_NUM 7
+MOD
+ADD
+STORE_SLOT 4
+LABEL L_end_if_3
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+.SITE while1.body
+LOAD_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 3
+MUL
+ADD
+LOAD_SLOT 1
+PUSH_NUM 2
+DIV
+SUB
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+LOAD_SLOT 1
+PUSH_NUM 10
+CMP_NEQ
+AND
+.SITE if0
+JUMP_IF_FALSE L_else_4
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+JUMP L_end_if_4
+LABEL L_else_4
+LOAD_SLOT 4
+LOAD_SLOT 1
+PUSH_NUM 7
+MOD
+ADD
+STORE_SLOT 4
+LABEL L_end_if_4
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 1
+LOAD_SLOT 0
+CMP_LT
+.SITE while1
+JUMP_IF_FALSE L_end_while_0
+.SITE while1.body
+LOAD_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 3
+MUL
+ADD
+LOAD_SLOT 1
+PUSH_NUM 2
+DIV
+SUB
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+LOAD_SLOT 1
+PUSH_NUM 10
+CMP_NEQ
+AND
+.SITE if0
+JUMP_IF_FALSE L_else_5
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+JUMP L_end_if_5
+LABEL L_else_5
+LOAD_SLOT 4
+LOAD_SLOT 1
+PUSH_NUM 7
+MOD
+ADD
+STORE_SLOT 4
+LABEL L_end_if_5
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+JUMP L_while_0
+LABEL L_end_while_0
+PUSH_STR "Soma: "
+LOAD_SLOT 2
+ADD
+PRINT
+PUSH_STR "Pares: "
+LOAD_SLOT 3
+ADD
+PRINT
+PUSH_STR "Resto: "
+LOAD_SLOT 4
+ADD
+PRINT
+PUSH_NUM 1
+STORE_SLOT 5
+PUSH_NUM 0
+STORE_SLOT 6
+LABEL L_while_6
+LOAD_SLOT 5
+PUSH_NUM 1
+CMP_NEQ
+LOAD_SLOT 6
+PUSH_NUM 0
+CMP_EQ
+OR
+.SITE while4
+JUMP_IF_FALSE L_end_while_6
+.SITE while4.body
+LOAD_SLOT 5
+PUSH_NUM 2
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if2
+JUMP_IF_FALSE L_else_7
+LOAD_SLOT 5
+PUSH_NUM 2
+DIV
+STORE_SLOT 5
+JUMP L_end_if_7
+LABEL L_else_7
+LOAD_SLOT 5
+PUSH_NUM 3
+MUL
+PUSH_NUM 1
+ADD
+STORE_SLOT 5
+LABEL L_end_if_7
+LOAD_SLOT 6
+PUSH_NUM 1
+ADD
+STORE_SLOT 6
+LOAD_SLOT 6
+PUSH_NUM 1
+CMP_EQ
+.SITE if3
+JUMP_IF_FALSE L_end_if_8
+PUSH_NUM 27
+STORE_SLOT 5
+LABEL L_end_if_8
+JUMP L_while_6
+LABEL L_end_while_6
+PUSH_STR "Passos: "
+LOAD_SLOT 6
+ADD
+PRINT
+PUSH_NUM 0
+STORE_SLOT 7
+PUSH_NUM 0
+STORE_SLOT 8
+LABEL L_while_9
+LOAD_SLOT 7
+PUSH_NUM 5
+CMP_LTE
+.SITE while6
+JUMP_IF_FALSE L_end_while_9
+.SITE while6.body
+PUSH_NUM 0
+STORE_SLOT 9
+LABEL L_unroll_10
+LOAD_SLOT 9
+PUSH_NUM 3
+ADD
+LOAD_SLOT 7
+CMP_LT
+JUMP_IF_FALSE L_while_10
+.SITE while5.body
+LOAD_SLOT 8
+LOAD_SLOT 7
+LOAD_SLOT 9
+MUL
+ADD
+LOAD_SLOT 9
+PUSH_NUM 2
+DIV
+ADD
+STORE_SLOT 8
+LOAD_SLOT 9
+PUSH_NUM 1
+ADD
+STORE_SLOT 9
+.SITE while5.body
+LOAD_SLOT 8
+LOAD_SLOT 7
+LOAD_SLOT 9
+MUL
+ADD
+LOAD_SLOT 9
+PUSH_NUM 2
+DIV
+ADD
+STORE_SLOT 8
+LOAD_SLOT 9
+PUSH_NUM 1
+ADD
+STORE_SLOT 9
+.SITE while5.body
+LOAD_SLOT 8
+LOAD_SLOT 7
+LOAD_SLOT 9
+MUL
+ADD
+LOAD_SLOT 9
+PUSH_NUM 2
+DIV
+ADD
+STORE_SLOT 8
+LOAD_SLOT 9
+PUSH_NUM 1
+ADD
+STORE_SLOT 9
+.SITE while5.body
+LOAD_SLOT 8
+LOAD_SLOT 7
+LOAD_SLOT 9
+MUL
+ADD
+LOAD_SLOT 9
+PUSH_NUM 2
+DIV
+ADD
+STORE_SLOT 8
+LOAD_SLOT 9
+PUSH_NUM 1
+ADD
+STORE_SLOT 9
+JUMP L_unroll_10
+LABEL L_while_10
+LOAD_SLOT 9
+LOAD_SLOT 7
+CMP_LT
+.SITE while5
+JUMP_IF_FALSE L_end_while_10
+.SITE while5.body
+LOAD_SLOT 8
+LOAD_SLOT 7
+LOAD_SLOT 9
+MUL
+ADD
+LOAD_SLOT 9
+PUSH_NUM 2
+DIV
+ADD
+STORE_SLOT 8
+LOAD_SLOT 9
+PUSH_NUM 1
+ADD
+STORE_SLOT 9
+JUMP L_while_10
+LABEL L_end_while_10
+LOAD_SLOT 7
+PUSH_NUM 1
+ADD
+STORE_SLOT 7
+JUMP L_while_9
+LABEL L_end_while_9
+PUSH_STR "Total: "
+LOAD_SLOT 8
+ADD
+PRINT_CONCL
+
+HALT
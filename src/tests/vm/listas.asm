@@ -1,85 +1,143 @@
 ; Arquivo gerado pelo compilador Maiêutic
 ; Fonte: ../tests/compiler/listas.ms
+.SOURCE_HASH a9a05022d26e6683
+
+.STACK 3
+.SLOTS 8
+.SYM 0 @frutas
+.SYM 1 @qtd
+.SYM 2 @primeira
+.SYM 3 @ultima
+.SYM 4 @nums
+.SYM 5 @soma
+.SYM 6 @contador
+.SYM 7 @lista_dinamica
 
 PUSH_STR "Maca"
 PUSH_STR "Banana"
 BUILD_LIST 2
-STORE @frutas
+STORE_SLOT 0
 PUSH_STR "Lista inicial: "
-LOAD @frutas
+LOAD_SLOT 0
 ADD
 PRINT
 PUSH_STR "Laranja"
-APPEND @frutas
+APPEND_SLOT 0
 PUSH_STR "Apos append: "
-LOAD @frutas
+LOAD_SLOT 0
 ADD
 PRINT
-LOAD @frutas
+LOAD_SLOT 0
 LEN
-STORE @qtd
+STORE_SLOT 1
 PUSH_STR "Tamanho atual: "
-LOAD @qtd
+LOAD_SLOT 1
 ADD
 PRINT_CONCL
-LOAD @frutas
+LOAD_SLOT 0
 PUSH_NUM 0
 INDEX
-STORE @primeira
-LOAD @frutas
+STORE_SLOT 2
+LOAD_SLOT 0
 PUSH_NUM 2
 INDEX
-STORE @ultima
+STORE_SLOT 3
 PUSH_STR "Primeira: "
-LOAD @primeira
+LOAD_SLOT 2
 ADD
 PRINT
 PUSH_STR "Ultima: "
-LOAD @ultima
+LOAD_SLOT 3
 ADD
 PRINT
 PUSH_NUM 10
 PUSH_NUM 20
 PUSH_NUM 30
 BUILD_LIST 3
-STORE @nums
-LOAD @nums
+STORE_SLOT 4
+LOAD_SLOT 4
 PUSH_NUM 0
 INDEX
-LOAD @nums
+LOAD_SLOT 4
 PUSH_NUM 1
 INDEX
 ADD
-LOAD @nums
+LOAD_SLOT 4
 PUSH_NUM 2
 INDEX
 ADD
-STORE @soma
+STORE_SLOT 5
 PUSH_STR "Soma dos elementos: "
-LOAD @soma
+LOAD_SLOT 5
 ADD
 PRINT_CONCL
 PUSH_NUM 0
-STORE @contador
+STORE_SLOT 6
 BUILD_LIST 0
-STORE @lista_dinamica
+STORE_SLOT 7
+LABEL L_unroll_0
+LOAD_SLOT 6
+PUSH_NUM 3
+ADD
+PUSH_NUM 3
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while0.body
+LOAD_SLOT 6
+PUSH_NUM 100
+MUL
+APPEND_SLOT 7
+LOAD_SLOT 6
+PUSH_NUM 1
+ADD
+STORE_SLOT 6
+.SITE while0.body
+LOAD_SLOT 6
+PUSH_NUM 100
+MUL
+APPEND_SLOT 7
+LOAD_SLOT 6
+PUSH_NUM 1
+ADD
+STORE_SLOT 6
+.SITE while0.body
+LOAD_SLOT 6
+PUSH_NUM 100
+MUL
+APPEND_SLOT 7
+LOAD_SLOT 6
+PUSH_NUM 1
+ADD
+STORE_SLOT 6
+.SITE while0.body
+LOAD_SLOT 6
+PUSH_NUM 100
+MUL
+APPEND_SLOT 7
+LOAD_SLOT 6
+PUSH_NUM 1
+ADD
+STORE_SLOT 6
+JUMP L_unroll_0
 LABEL L_while_0
-LOAD @contador
+LOAD_SLOT 6
 PUSH_NUM 3
 CMP_LT
+.SITE while0
 JUMP_IF_FALSE L_end_while_0
-LOAD @contador
+.SITE while0.body
+LOAD_SLOT 6
 PUSH_NUM 100
 MUL
-APPEND @lista_dinamica
-LOAD @contador
+APPEND_SLOT 7
+LOAD_SLOT 6
 PUSH_NUM 1
 ADD
-STORE @contador
+STORE_SLOT 6
 JUMP L_while_0
 LABEL L_end_while_0
 PUSH_STR "Lista gerada no loop: "
-LOAD @lista_dinamica
+LOAD_SLOT 7
 ADD
 PRINT_CONCL
 
@@ -1,24 +1,76 @@
 ; Arquivo gerado pelo compilador Maiêutic
 ; Fonte: ../tests/compiler/loop.ms
+.SOURCE_HASH 32b153dce8f40784
+
+.STACK 2
+.SLOTS 2
+.SYM 0 @i
+.SYM 1 @n
 
 PUSH_NUM 1
-STORE @i
+STORE_SLOT 0
 PUSH_STR "Digite um número inteiro N (>= 1):"
 QUESTION
-INPUT @n
+INPUT_SLOT 1
+LABEL L_unroll_0
+LOAD_SLOT 0
+PUSH_NUM 3
+ADD
+LOAD_SLOT 1
+CMP_LTE
+JUMP_IF_FALSE L_while_0
+.SITE while0.body
+PUSH_STR "i = "
+LOAD_SLOT 0
+ADD
+PRINT
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while0.body
+PUSH_STR "i = "
+LOAD_SLOT 0
+ADD
+PRINT
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while0.body
+PUSH_STR "i = "
+LOAD_SLOT 0
+ADD
+PRINT
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while0.body
+PUSH_STR "i = "
+LOAD_SLOT 0
+ADD
+PRINT
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+JUMP L_unroll_0
 LABEL L_while_0
-LOAD @i
-LOAD @n
+LOAD_SLOT 0
+LOAD_SLOT 1
 CMP_LTE
+.SITE while0
 JUMP_IF_FALSE L_end_while_0
+.SITE while0.body
 PUSH_STR "i = "
-LOAD @i
+LOAD_SLOT 0
 ADD
 PRINT
-LOAD @i
+LOAD_SLOT 0
 PUSH_NUM 1
 ADD
-STORE @i
+STORE_SLOT 0
 JUMP L_while_0
 LABEL L_end_while_0
 PUSH_STR "Fim do loop."
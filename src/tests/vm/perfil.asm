@@ -0,0 +1,317 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/perfil.ms
+; Perfil: ../tests/vm/perfil.prof
+.SOURCE_HASH 4c2198dd8ff1c6db
+
+.STACK 2
+.SLOTS 6
+.SYM 0 @respostas
+.SYM 1 @sim
+.SYM 2 @nao
+.SYM 3 @r
+.SYM 4 @i
+.SYM 5 @comuns
+
+PUSH_NUM 0
+STORE_SLOT 0
+PUSH_NUM 0
+STORE_SLOT 1
+PUSH_NUM 0
+STORE_SLOT 2
+LABEL L_unroll_0
+LOAD_SLOT 0
+PUSH_NUM 3
+ADD
+PUSH_NUM 4
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while1.body
+PUSH_STR "Você concorda?"
+QUESTION
+INPUT_SLOT 3
+LOAD_SLOT 3
+PUSH_BOOL 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_cold_1
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+LABEL L_end_if_1
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while1.body
+PUSH_STR "Você concorda?"
+QUESTION
+INPUT_SLOT 3
+LOAD_SLOT 3
+PUSH_BOOL 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_cold_2
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+LABEL L_end_if_2
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while1.body
+PUSH_STR "Você concorda?"
+QUESTION
+INPUT_SLOT 3
+LOAD_SLOT 3
+PUSH_BOOL 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_cold_3
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+LABEL L_end_if_3
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+.SITE while1.body
+PUSH_STR "Você concorda?"
+QUESTION
+INPUT_SLOT 3
+LOAD_SLOT 3
+PUSH_BOOL 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_cold_4
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+LABEL L_end_if_4
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 0
+PUSH_NUM 4
+CMP_LT
+.SITE while1
+JUMP_IF_FALSE L_end_while_0
+.SITE while1.body
+PUSH_STR "Você concorda?"
+QUESTION
+INPUT_SLOT 3
+LOAD_SLOT 3
+PUSH_BOOL 1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_cold_5
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+LABEL L_end_if_5
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+STORE_SLOT 0
+JUMP L_while_0
+LABEL L_end_while_0
+PUSH_NUM 0
+STORE_SLOT 4
+PUSH_NUM 0
+STORE_SLOT 5
+LABEL L_unroll_6
+LOAD_SLOT 4
+PUSH_NUM 3
+ADD
+PUSH_NUM 200
+CMP_LT
+JUMP_IF_FALSE L_while_6
+.SITE while3.body
+LOAD_SLOT 4
+PUSH_NUM 50
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if2
+JUMP_IF_TRUE L_cold_7
+LOAD_SLOT 5
+PUSH_NUM 1
+ADD
+STORE_SLOT 5
+LABEL L_end_if_7
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+.SITE while3.body
+LOAD_SLOT 4
+PUSH_NUM 50
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if2
+JUMP_IF_TRUE L_cold_8
+LOAD_SLOT 5
+PUSH_NUM 1
+ADD
+STORE_SLOT 5
+LABEL L_end_if_8
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+.SITE while3.body
+LOAD_SLOT 4
+PUSH_NUM 50
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if2
+JUMP_IF_TRUE L_cold_9
+LOAD_SLOT 5
+PUSH_NUM 1
+ADD
+STORE_SLOT 5
+LABEL L_end_if_9
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+.SITE while3.body
+LOAD_SLOT 4
+PUSH_NUM 50
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if2
+JUMP_IF_TRUE L_cold_10
+LOAD_SLOT 5
+PUSH_NUM 1
+ADD
+STORE_SLOT 5
+LABEL L_end_if_10
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+JUMP L_unroll_6
+LABEL L_while_6
+LOAD_SLOT 4
+PUSH_NUM 200
+CMP_LT
+.SITE while3
+JUMP_IF_FALSE L_end_while_6
+.SITE while3.body
+LOAD_SLOT 4
+PUSH_NUM 50
+MOD
+PUSH_NUM 0
+CMP_EQ
+.SITE if2
+JUMP_IF_TRUE L_cold_11
+LOAD_SLOT 5
+PUSH_NUM 1
+ADD
+STORE_SLOT 5
+LABEL L_end_if_11
+LOAD_SLOT 4
+PUSH_NUM 1
+ADD
+STORE_SLOT 4
+JUMP L_while_6
+LABEL L_end_while_6
+PUSH_STR "Sim: "
+LOAD_SLOT 1
+ADD
+PUSH_STR ", Nao: "
+ADD
+LOAD_SLOT 2
+ADD
+PUSH_STR ", comuns: "
+ADD
+LOAD_SLOT 5
+ADD
+PRINT_CONCL
+
+HALT
+
+; Código frio (pouco executado segundo o perfil)
+LABEL L_cold_1
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+PUSH_STR "Discordância registrada"
+PRINT
+JUMP L_end_if_1
+LABEL L_cold_2
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+PUSH_STR "Discordância registrada"
+PRINT
+JUMP L_end_if_2
+LABEL L_cold_3
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+PUSH_STR "Discordância registrada"
+PRINT
+JUMP L_end_if_3
+LABEL L_cold_4
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+PUSH_STR "Discordância registrada"
+PRINT
+JUMP L_end_if_4
+LABEL L_cold_5
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+PUSH_STR "Discordância registrada"
+PRINT
+JUMP L_end_if_5
+LABEL L_cold_7
+PUSH_STR "Marco: "
+LOAD_SLOT 4
+ADD
+PRINT
+JUMP L_end_if_7
+LABEL L_cold_8
+PUSH_STR "Marco: "
+LOAD_SLOT 4
+ADD
+PRINT
+JUMP L_end_if_8
+LABEL L_cold_9
+PUSH_STR "Marco: "
+LOAD_SLOT 4
+ADD
+PRINT
+JUMP L_end_if_9
+LABEL L_cold_10
+PUSH_STR "Marco: "
+LOAD_SLOT 4
+ADD
+PRINT
+JUMP L_end_if_10
+LABEL L_cold_11
+PUSH_STR "Marco: "
+LOAD_SLOT 4
+ADD
+PRINT
+JUMP L_end_if_11
@@ -0,0 +1,237 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/pilha.ms
+.SOURCE_HASH ecb9cc15781773be
+
+.STACK 7
+.SLOTS 4
+.SYM 0 @base
+.SYM 1 @matriz
+.SYM 2 @i
+.SYM 3 @soma
+
+PUSH_NUM 2
+STORE_SLOT 0
+PUSH_NUM 1
+PUSH_NUM 2
+PUSH_NUM 3
+PUSH_NUM 4
+PUSH_NUM 5
+PUSH_NUM 6
+LOAD_SLOT 0
+SUB
+MUL
+ADD
+BUILD_LIST 2
+BUILD_LIST 3
+PUSH_STR "a"
+PUSH_STR "b"
+PUSH_STR "c"
+LOAD_SLOT 0
+ADD
+ADD
+ADD
+BUILD_LIST 2
+STORE_SLOT 1
+LOAD_SLOT 1
+PRINT
+PUSH_NUM 1
+PUSH_NUM 2
+PUSH_NUM 3
+PUSH_NUM 4
+PUSH_NUM 5
+PUSH_NUM 6
+LOAD_SLOT 0
+ADD
+ADD
+ADD
+ADD
+ADD
+ADD
+PRINT
+PUSH_NUM 0
+STORE_SLOT 2
+PUSH_NUM 0
+STORE_SLOT 3
+LOAD_SLOT 0
+PUSH_NUM 1
+ADD
+MOV_TOP_R0
+LOAD_SLOT 0
+PUSH_NUM 0
+MUL
+MOV_TOP_R1
+LABEL L_unroll_0
+LOAD_SLOT 2
+PUSH_NUM 3
+ADD
+PUSH_NUM 3
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while1.body
+LOAD_SLOT 3
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 2
+PUSH_R0
+MOD
+ADD
+MUL
+ADD
+STORE_SLOT 3
+LOAD_SLOT 3
+PUSH_NUM 2
+CMP_GT
+.SITE if0
+JUMP_IF_FALSE L_end_if_1
+PUSH_STR "Soma parcial: "
+LOAD_SLOT 3
+LOAD_SLOT 2
+PUSH_R1
+SUB
+ADD
+ADD
+PRINT
+LABEL L_end_if_1
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+.SITE while1.body
+LOAD_SLOT 3
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 2
+PUSH_R0
+MOD
+ADD
+MUL
+ADD
+STORE_SLOT 3
+LOAD_SLOT 3
+PUSH_NUM 2
+CMP_GT
+.SITE if0
+JUMP_IF_FALSE L_end_if_2
+PUSH_STR "Soma parcial: "
+LOAD_SLOT 3
+LOAD_SLOT 2
+PUSH_R1
+SUB
+ADD
+ADD
+PRINT
+LABEL L_end_if_2
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+.SITE while1.body
+LOAD_SLOT 3
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 2
+PUSH_R0
+MOD
+ADD
+MUL
+ADD
+STORE_SLOT 3
+LOAD_SLOT 3
+PUSH_NUM 2
+CMP_GT
+.SITE if0
+JUMP_IF_FALSE L_end_if_3
+PUSH_STR "Soma parcial: "
+LOAD_SLOT 3
+LOAD_SLOT 2
+PUSH_R1
+SUB
+ADD
+ADD
+PRINT
+LABEL L_end_if_3
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+.SITE while1.body
+LOAD_SLOT 3
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 2
+PUSH_R0
+MOD
+ADD
+MUL
+ADD
+STORE_SLOT 3
+LOAD_SLOT 3
+PUSH_NUM 2
+CMP_GT
+.SITE if0
+JUMP_IF_FALSE L_end_if_4
+PUSH_STR "Soma parcial: "
+LOAD_SLOT 3
+LOAD_SLOT 2
+PUSH_R1
+SUB
+ADD
+ADD
+PRINT
+LABEL L_end_if_4
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 2
+PUSH_NUM 3
+CMP_LT
+.SITE while1
+JUMP_IF_FALSE L_end_while_0
+.SITE while1.body
+LOAD_SLOT 3
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 2
+PUSH_R0
+MOD
+ADD
+MUL
+ADD
+STORE_SLOT 3
+LOAD_SLOT 3
+PUSH_NUM 2
+CMP_GT
+.SITE if0
+JUMP_IF_FALSE L_end_if_5
+PUSH_STR "Soma parcial: "
+LOAD_SLOT 3
+LOAD_SLOT 2
+PUSH_R1
+SUB
+ADD
+ADD
+PRINT
+LABEL L_end_if_5
+LOAD_SLOT 2
+PUSH_NUM 1
+ADD
+STORE_SLOT 2
+JUMP L_while_0
+LABEL L_end_while_0
+LOAD_SLOT 1
+LEN
+LOAD_SLOT 1
+LEN
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+MUL
+ADD
+PRINT
+PUSH_STR "Pilha calculada."
+PRINT_CONCL
+
+HALT
@@ -0,0 +1,288 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/registradores.ms
+.SOURCE_HASH 50a1c95c4d1857a7
+
+.STACK 5
+.SLOTS 8
+.SYM 0 @n
+.SYM 1 @base
+.SYM 2 @pesos
+.SYM 3 @i
+.SYM 4 @total
+.SYM 5 %r2
+.SYM 6 %r3
+.SYM 7 %r4
+
+PUSH_NUM 4
+STORE_SLOT 0
+PUSH_NUM 10
+STORE_SLOT 1
+PUSH_NUM 3
+PUSH_NUM 1
+PUSH_NUM 4
+PUSH_NUM 1
+PUSH_NUM 5
+BUILD_LIST 5
+STORE_SLOT 2
+PUSH_NUM 0
+STORE_SLOT 3
+PUSH_NUM 0
+STORE_SLOT 4
+LOAD_SLOT 1
+PUSH_NUM 2
+MUL
+PUSH_NUM 1
+ADD
+MOV_TOP_R0
+LOAD_SLOT 0
+PUSH_NUM 1
+SUB
+MOV_TOP_R1
+LOAD_SLOT 0
+PUSH_NUM 1
+SUB
+STORE_SLOT 5
+LOAD_SLOT 2
+LEN
+STORE_SLOT 6
+LOAD_SLOT 1
+PUSH_NUM 7
+SUB
+STORE_SLOT 7
+LABEL L_unroll_0
+LOAD_SLOT 3
+PUSH_NUM 3
+ADD
+LOAD_SLOT 0
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while1.body
+LOAD_SLOT 4
+LOAD_SLOT 3
+PUSH_R0
+MUL
+ADD
+STORE_SLOT 4
+LOAD_SLOT 3
+PUSH_R1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_else_1
+PUSH_STR "Último: "
+LOAD_SLOT 2
+LOAD_SLOT 5
+LOAD_SLOT 3
+SUB
+INDEX
+ADD
+PUSH_STR " de "
+ADD
+LOAD_SLOT 6
+ADD
+PRINT
+JUMP L_end_if_1
+LABEL L_else_1
+PUSH_STR "Peso "
+LOAD_SLOT 3
+ADD
+PUSH_STR ": "
+ADD
+LOAD_SLOT 2
+LOAD_SLOT 3
+INDEX
+LOAD_SLOT 7
+MUL
+ADD
+PRINT
+LABEL L_end_if_1
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+.SITE while1.body
+LOAD_SLOT 4
+LOAD_SLOT 3
+PUSH_R0
+MUL
+ADD
+STORE_SLOT 4
+LOAD_SLOT 3
+PUSH_R1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_else_2
+PUSH_STR "Último: "
+LOAD_SLOT 2
+LOAD_SLOT 5
+LOAD_SLOT 3
+SUB
+INDEX
+ADD
+PUSH_STR " de "
+ADD
+LOAD_SLOT 6
+ADD
+PRINT
+JUMP L_end_if_2
+LABEL L_else_2
+PUSH_STR "Peso "
+LOAD_SLOT 3
+ADD
+PUSH_STR ": "
+ADD
+LOAD_SLOT 2
+LOAD_SLOT 3
+INDEX
+LOAD_SLOT 7
+MUL
+ADD
+PRINT
+LABEL L_end_if_2
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+.SITE while1.body
+LOAD_SLOT 4
+LOAD_SLOT 3
+PUSH_R0
+MUL
+ADD
+STORE_SLOT 4
+LOAD_SLOT 3
+PUSH_R1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_else_3
+PUSH_STR "Último: "
+LOAD_SLOT 2
+LOAD_SLOT 5
+LOAD_SLOT 3
+SUB
+INDEX
+ADD
+PUSH_STR " de "
+ADD
+LOAD_SLOT 6
+ADD
+PRINT
+JUMP L_end_if_3
+LABEL L_else_3
+PUSH_STR "Peso "
+LOAD_SLOT 3
+ADD
+PUSH_STR ": "
+ADD
+LOAD_SLOT 2
+LOAD_SLOT 3
+INDEX
+LOAD_SLOT 7
+MUL
+ADD
+PRINT
+LABEL L_end_if_3
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+.SITE while1.body
+LOAD_SLOT 4
+LOAD_SLOT 3
+PUSH_R0
+MUL
+ADD
+STORE_SLOT 4
+LOAD_SLOT 3
+PUSH_R1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_else_4
+PUSH_STR "Último: "
+LOAD_SLOT 2
+LOAD_SLOT 5
+LOAD_SLOT 3
+SUB
+INDEX
+ADD
+PUSH_STR " de "
+ADD
+LOAD_SLOT 6
+ADD
+PRINT
+JUMP L_end_if_4
+LABEL L_else_4
+PUSH_STR "Peso "
+LOAD_SLOT 3
+ADD
+PUSH_STR ": "
+ADD
+LOAD_SLOT 2
+LOAD_SLOT 3
+INDEX
+LOAD_SLOT 7
+MUL
+ADD
+PRINT
+LABEL L_end_if_4
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 3
+LOAD_SLOT 0
+CMP_LT
+.SITE while1
+JUMP_IF_FALSE L_end_while_0
+.SITE while1.body
+LOAD_SLOT 4
+LOAD_SLOT 3
+PUSH_R0
+MUL
+ADD
+STORE_SLOT 4
+LOAD_SLOT 3
+PUSH_R1
+CMP_EQ
+.SITE if0
+JUMP_IF_FALSE L_else_5
+PUSH_STR "Último: "
+LOAD_SLOT 2
+LOAD_SLOT 5
+LOAD_SLOT 3
+SUB
+INDEX
+ADD
+PUSH_STR " de "
+ADD
+LOAD_SLOT 6
+ADD
+PRINT
+JUMP L_end_if_5
+LABEL L_else_5
+PUSH_STR "Peso "
+LOAD_SLOT 3
+ADD
+PUSH_STR ": "
+ADD
+LOAD_SLOT 2
+LOAD_SLOT 3
+INDEX
+LOAD_SLOT 7
+MUL
+ADD
+PRINT
+LABEL L_end_if_5
+LOAD_SLOT 3
+PUSH_NUM 1
+ADD
+STORE_SLOT 3
+JUMP L_while_0
+LABEL L_end_while_0
+PUSH_STR "Total: "
+LOAD_SLOT 4
+ADD
+PRINT_CONCL
+
+HALT
@@ -0,0 +1,225 @@
+; Arquivo gerado pelo compilador Maiêutic
+; Fonte: ../tests/compiler/tamanho.ms
+.SOURCE_HASH 0efc5c70f3fa188f
+
+.STACK 6
+.SLOTS 7
+.SYM 0 @notas
+.SYM 1 @i
+.SYM 2 @soma
+.SYM 3 @fila
+.SYM 4 @lista
+.SYM 5 @original
+.SYM 6 @apelido
+
+PUSH_NUM 7
+PUSH_NUM 5
+PUSH_NUM 9
+PUSH_NUM 6
+BUILD_LIST 4
+STORE_SLOT 0
+PUSH_NUM 0
+STORE_SLOT 1
+PUSH_NUM 0
+STORE_SLOT 2
+LOAD_SLOT 0
+LEN
+MOV_TOP_R0
+LABEL L_unroll_0
+LOAD_SLOT 1
+PUSH_NUM 3
+ADD
+PUSH_R0
+CMP_LT
+JUMP_IF_FALSE L_while_0
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+PUSH_NUM 1
+ADD
+STORE_INDEX_SLOT 0
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+ADD
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+PUSH_NUM 1
+ADD
+STORE_INDEX_SLOT 0
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+ADD
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+PUSH_NUM 1
+ADD
+STORE_INDEX_SLOT 0
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+ADD
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+PUSH_NUM 1
+ADD
+STORE_INDEX_SLOT 0
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+ADD
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+JUMP L_unroll_0
+LABEL L_while_0
+LOAD_SLOT 1
+PUSH_R0
+CMP_LT
+.SITE while0
+JUMP_IF_FALSE L_end_while_0
+.SITE while0.body
+LOAD_SLOT 1
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+PUSH_NUM 1
+ADD
+STORE_INDEX_SLOT 0
+LOAD_SLOT 2
+LOAD_SLOT 0
+LOAD_SLOT 1
+INDEX
+ADD
+STORE_SLOT 2
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+JUMP L_while_0
+LABEL L_end_while_0
+PUSH_STR "Notas: "
+LOAD_SLOT 0
+ADD
+PUSH_STR ", soma: "
+ADD
+LOAD_SLOT 2
+ADD
+PRINT
+PUSH_NUM 1
+BUILD_LIST 1
+STORE_SLOT 3
+LABEL L_while_1
+LOAD_SLOT 3
+LEN
+PUSH_NUM 5
+CMP_LT
+.SITE while1
+JUMP_IF_FALSE L_end_while_1
+.SITE while1.body
+LOAD_SLOT 3
+LEN
+PUSH_NUM 10
+MUL
+APPEND_SLOT 3
+JUMP L_while_1
+LABEL L_end_while_1
+PUSH_STR "Fila: "
+LOAD_SLOT 3
+ADD
+PRINT
+PUSH_NUM 1
+PUSH_NUM 2
+PUSH_NUM 3
+PUSH_NUM 4
+PUSH_NUM 5
+PUSH_NUM 6
+BUILD_LIST 6
+STORE_SLOT 4
+PUSH_NUM 0
+STORE_SLOT 1
+LABEL L_while_2
+LOAD_SLOT 1
+LOAD_SLOT 4
+LEN
+CMP_LT
+.SITE while3
+JUMP_IF_FALSE L_end_while_2
+.SITE while3.body
+LOAD_SLOT 1
+PUSH_NUM 1
+CMP_EQ
+.SITE if2
+JUMP_IF_FALSE L_end_if_3
+PUSH_NUM 0
+PUSH_NUM 0
+PUSH_NUM 0
+BUILD_LIST 3
+STORE_SLOT 4
+LABEL L_end_if_3
+LOAD_SLOT 1
+PUSH_NUM 1
+ADD
+STORE_SLOT 1
+JUMP L_while_2
+LABEL L_end_while_2
+PUSH_STR "Voltas com a lista trocada: "
+LOAD_SLOT 1
+ADD
+PRINT
+PUSH_NUM 1
+BUILD_LIST 1
+STORE_SLOT 5
+LOAD_SLOT 5
+STORE_SLOT 6
+LABEL L_while_4
+LOAD_SLOT 5
+LEN
+PUSH_NUM 4
+CMP_LT
+.SITE while4
+JUMP_IF_FALSE L_end_while_4
+.SITE while4.body
+PUSH_NUM 0
+APPEND_SLOT 6
+JUMP L_while_4
+LABEL L_end_while_4
+PUSH_STR "Pelo apelido: "
+LOAD_SLOT 5
+ADD
+PRINT_CONCL
+
+HALT
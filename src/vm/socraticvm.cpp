@@ -0,0 +1,1317 @@
+// SocraticVM nativa - a mesma máquina de socraticvm.py, em C++
+//
+// Uso:
+//   ./socraticvm programa.asm
+//   ./socraticvm programa.asm --trace   # mostra o trace das instruções
+//   ./socraticvm programa.asm --profile-out=perfil.txt   # grava o perfil
+//   ./socraticvm programa.asm --verify  # só verifica o programa
+//   ./socraticvm programa.asm --trace-ring=trace.bin   # trace binário em anel
+//   ./socraticvm programa.asm --trace-decode=trace.bin # lê o trace binário
+//   ./socraticvm programa.asm --sample-out=amostras.txt # perfil por amostragem
+//   ./socraticvm programa.asm --stats                   # estatísticas por opcode
+//
+// O .asm é decodificado uma vez no carregamento: cada instrução vira um
+// opcode e um operando inteiro (slot, destino do salto, constante já
+// convertida ou contagem), e o laço de execução salta direto para o
+// tratador do opcode (computed goto do GCC/Clang; switch nos demais
+// compiladores). Valores, operações, INPUT e mensagens "[VM] ..." vêm do
+// runtime do --emit=c (src/runtime/maieutic_rt.h), que já reproduz a VM em
+// Python; a saída é idêntica à dela nos testes de src/tests. Toda a saída
+// padrão passa pelo buffer de rt::console (maieutic_io.h), que só a grava
+// quando enche, antes de um INPUT ler a entrada e no fim.
+//
+// Depois de carregado, o programa é verificado (Loader::verify, as mesmas
+// regras de verify_program em Python). Um programa verificado roda numa
+// instância do laço sem nenhum teste de pilha: ela é alocada uma vez, com
+// a profundidade máxima calculada, e nunca fica curta nem transborda.
+//
+// Compilação (ou "make" em src/vm):
+//   g++ -std=c++17 -O2 -I ../runtime socraticvm.cpp -o socraticvm
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "maieutic_rt.h"
+
+#if defined(__GNUC__)
+#define VM_THREADED 1
+#else
+#define VM_THREADED 0
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VM_POSIX 1
+#include <sys/time.h>
+#include <unistd.h>
+#else
+#define VM_POSIX 0
+#endif
+
+namespace vm {
+
+using rt::Value;
+
+// Opcodes decodificados. As instruções inválidas do .asm viram NOTICE
+// (mensagem e segue), NOTICE_NIL (idem, empilhando Nulo), ABORT (mensagem e
+// fim do programa) ou FAIL (exceção da VM em Python: stderr e código 1).
+#define VM_OPCODES(X)                                                          \
+    X(HALT) X(END) X(PUSH_CONST) X(PUSH_NIL)                                   \
+    X(LOAD) X(STORE) X(APPEND) X(STORE_INDEX) X(INDEX)                         \
+    X(ADD) X(SUB) X(MUL) X(DIV) X(MOD)                                         \
+    X(CMP_EQ) X(CMP_NEQ) X(CMP_LT) X(CMP_LTE) X(CMP_GT) X(CMP_GTE)             \
+    X(AND) X(OR) X(LEN) X(BUILD_LIST)                                          \
+    X(QUESTION) X(PRINT) X(PRINT_CONCL) X(INPUT)                               \
+    X(JUMP) X(JUMP_IF_FALSE) X(JUMP_IF_TRUE)                                   \
+    X(MOV_TOP_R0) X(MOV_TOP_R1) X(PUSH_R0) X(PUSH_R1)                          \
+    X(SENSOR_TIME) X(SENSOR_RAND)                                              \
+    X(NOTICE) X(NOTICE_NIL) X(ABORT) X(FAIL)
+
+enum Op : unsigned char {
+#define VM_ENUM(name) name,
+    VM_OPCODES(VM_ENUM)
+#undef VM_ENUM
+};
+
+inline const char* opName(unsigned op) {
+    static const char* const names[] = {
+#define VM_NAME(name) #name,
+        VM_OPCODES(VM_NAME)
+#undef VM_NAME
+    };
+    return op < sizeof(names) / sizeof(names[0]) ? names[op] : "?";
+}
+
+struct Instr {
+    Op op;
+    int arg = 0;   // slot, destino (-1: label inexistente), constante, contagem ou mensagem
+};
+
+// Instrução como escrita no .asm: para o --trace, o perfil e as mensagens
+struct SourceInstr {
+    std::string op;
+    std::vector<std::string> args;
+    std::vector<std::string> sites;   // .SITE desta instrução
+    int lines = -1;                    // linhas do fonte (.LINE): índice em Program::lineStacks
+};
+
+struct Program {
+    std::vector<Instr> code;           // termina com END (fim do programa sem HALT)
+    std::vector<SourceInstr> source;   // uma por instrução de `code`, sem o END
+    std::vector<Value> constants;      // PUSH_NUM, PUSH_BOOL e PUSH_STR já convertidos
+    std::vector<std::string> messages;
+    std::vector<std::string> slotNames;
+    std::vector<std::string> lineStacks;   // .FILE/.LINE, como pilhas "folded" ("a.ms:8;a.ms:9")
+    size_t slotCount = 0;
+    long stackSize = -1;               // .STACK; -1 sem a diretiva (assembly escrito à mão)
+    std::string sourceHash;            // .SOURCE_HASH: vai para o perfil
+    size_t maxDepth = 0;               // profundidade máxima, calculada por Loader::verify
+};
+
+// -------------------- Carregamento --------------------
+
+[[noreturn]] inline void loadError(const std::string& msg) {
+    rt::message(msg.c_str());
+    std::exit(1);
+}
+
+inline std::vector<std::string> split(std::string_view s) {
+    std::vector<std::string> parts;
+    size_t start = 0;
+    for (size_t i = 0; i <= s.size();) {
+        size_t space = i < s.size() ? rt::spaceAt(s.substr(i)) : 1;
+        if (space == 0) {
+            ++i;
+            continue;
+        }
+        if (i > start) parts.emplace_back(s.substr(start, i - start));
+        i += space;
+        start = i;
+    }
+    return parts;
+}
+
+// int() do Python para os operandos inteiros; false se não é um inteiro
+inline bool parseInt(const std::string& s, long& out) {
+    if (s.empty()) return false;
+    char* end;
+    errno = 0;
+    out = std::strtol(s.c_str(), &end, 10);
+    return *end == '\0' && errno == 0;
+}
+
+// float() do Python; 0.0 se o texto não é um número (como a VM)
+inline double parseNumber(const std::string& s) {
+    if (s.empty() || s.find_first_of("xX") != std::string::npos) return 0.0;
+    char* end;
+    double d = std::strtod(s.c_str(), &end);
+    return *end == '\0' ? d : 0.0;
+}
+
+// float() do Python aceitaria o texto?
+inline bool validNumber(const std::string& s) {
+    if (s.empty() || s.find_first_of("xX") != std::string::npos) return false;
+    char* end;
+    std::strtod(s.c_str(), &end);
+    return *end == '\0';
+}
+
+// Literal entre aspas, sem aspas soltas dentro nem escape pela metade
+inline bool wellFormedString(std::string_view s) {
+    if (s.size() < 2 || s.front() != '"' || s.back() != '"') return false;
+    bool escape = false;
+    for (char c : s.substr(1, s.size() - 2)) {
+        if (escape) escape = false;
+        else if (c == '\\') escape = true;
+        else if (c == '"') return false;
+    }
+    return !escape;
+}
+
+// "texto \"aspas\"" -> texto "aspas" (mesmas regras de parse_string_literal)
+inline std::string parseStringLiteral(std::string_view s) {
+    s = rt::strip(s);
+    size_t first = s.find('"'), last = s.rfind('"');
+    if (first == std::string_view::npos || last <= first) return std::string(s);
+    std::string out;
+    bool escape = false;
+    for (char c : s.substr(first + 1, last - first - 1)) {
+        if (escape) {
+            out += c;
+            escape = false;
+        } else if (c == '\\') {
+            escape = true;
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+class Loader {
+    Program& p;
+    std::unordered_map<std::string, int> symbols;   // nome -> slot
+    std::unordered_map<std::string, int> labels;
+
+    int slotOf(const std::string& name) {
+        auto it = symbols.find(name);
+        if (it != symbols.end()) return it->second;
+        int slot = (int)p.slotNames.size();
+        symbols.emplace(name, slot);
+        p.slotNames.push_back(name);
+        return slot;
+    }
+
+    void growSlots(size_t slot) {
+        while (slot >= p.slotNames.size()) p.slotNames.push_back("<slot " + std::to_string(p.slotNames.size()) + ">");
+    }
+
+    int message(std::string text) {
+        p.messages.push_back(std::move(text));
+        return (int)p.messages.size() - 1;
+    }
+
+    int constant(Value v) {
+        p.constants.push_back(std::move(v));
+        return (int)p.constants.size() - 1;
+    }
+
+    void parseLines(const std::string& text) {
+        size_t declared = 0;
+        std::vector<std::string> pendingSites;
+        std::string sourceFile = "?";
+        int lines = -1;
+        size_t pos = 0;
+        for (int lineNo = 1; pos < text.size(); ++lineNo) {
+            // Quebras de linha universais, como a leitura em modo texto do Python
+            size_t eol = text.find_first_of("\r\n", pos);
+            if (eol == std::string::npos) eol = text.size();
+            std::string_view line = rt::strip(std::string_view(text).substr(pos, eol - pos));
+            pos = eol + (text.compare(eol, 2, "\r\n") == 0 ? 2 : 1);
+
+            if (line.empty() || line[0] == ';') continue;
+
+            // Cabeçalho da tabela de símbolos: .SLOTS <n> e .SYM <slot> <nome>
+            if (line[0] == '.') {
+                std::vector<std::string> parts = split(line);
+                long n;
+                if (parts[0] == ".SLOTS" && parts.size() == 2 && parseInt(parts[1], n)) {
+                    declared = (size_t)std::max(n, 0L);
+                } else if (parts[0] == ".SYM" && parts.size() == 3 && parseInt(parts[1], n) && n >= 0) {
+                    growSlots((size_t)n);
+                    p.slotNames[n] = parts[2];
+                    symbols[parts[2]] = (int)n;
+                } else if (parts[0] == ".STACK" && parts.size() == 2 && parseInt(parts[1], n) && n >= 0) {
+                    p.stackSize = n;
+                } else if (parts[0] == ".SOURCE_HASH" && parts.size() == 2) {
+                    p.sourceHash = parts[1];
+                } else if (parts[0] == ".SITE" && parts.size() == 2) {
+                    pendingSites.push_back(parts[1]);   // vale para a próxima instrução
+                } else if (parts[0] == ".FILE" && parts.size() >= 2) {
+                    sourceFile = rt::strip(line.substr(5));   // tabela de linhas (-g)
+                } else if (parts[0] == ".LINE" && parts.size() >= 2
+                           && std::all_of(parts.begin() + 1, parts.end(), [](const std::string& l) {
+                                  return l.find_first_not_of("0123456789") == std::string::npos;
+                              })) {
+                    // vale até a próxima .LINE: a linha do comando, depois
+                    // das linhas dos comandos que o contêm
+                    std::string stack;
+                    for (size_t i = 1; i < parts.size(); ++i) stack += (i > 1 ? ";" : "") + sourceFile + ":" + parts[i];
+                    lines = (int)p.lineStacks.size();
+                    p.lineStacks.push_back(std::move(stack));
+                } else {
+                    loadError("[VM] Diretiva inválida na linha " + std::to_string(lineNo) + ": " + std::string(line));
+                }
+                continue;
+            }
+
+            // LABEL só registra endereço
+            if (line.compare(0, 5, "LABEL") == 0) {
+                std::vector<std::string> parts = split(line);
+                if (parts.size() < 2) loadError("[VM] Erro de sintaxe em LABEL na linha " + std::to_string(lineNo));
+                labels[parts[1]] = (int)p.source.size();
+                continue;
+            }
+
+            SourceInstr ins;
+            if (line.compare(0, 8, "PUSH_STR") == 0) {
+                ins.op = "PUSH_STR";
+                ins.args.emplace_back(rt::strip(line.substr(8)));
+            } else {
+                std::vector<std::string> parts = split(line);
+                ins.op = parts[0];
+                ins.args.assign(parts.begin() + 1, parts.end());
+            }
+            ins.lines = lines;
+            p.source.push_back(std::move(ins));
+            if (!pendingSites.empty()) p.source.back().sites.swap(pendingSites);
+        }
+        p.slotCount = declared;
+    }
+
+    // Slot de cada acesso a variável (resolve_slots da VM em Python)
+    std::vector<int> resolveSlots() {
+        static const char* const named[] = {"LOAD", "STORE", "APPEND", "STORE_INDEX", "INPUT"};
+        std::vector<int> slots(p.source.size(), -1);
+        for (size_t i = 0; i < p.source.size(); ++i) {
+            const SourceInstr& ins = p.source[i];
+            if (ins.args.empty()) continue;
+            for (const char* base : named) {
+                if (ins.op == base) {
+                    slots[i] = slotOf(ins.args[0]);
+                } else if (ins.op == std::string(base) + "_SLOT") {
+                    long n;
+                    if (!parseInt(ins.args[0], n) || n < 0) {
+                        loadError("[VM] Slot inválido em " + ins.op + ": " + ins.args[0]);
+                    }
+                    slots[i] = (int)n;
+                    growSlots((size_t)n);
+                }
+            }
+        }
+        p.slotCount = std::max(p.slotCount, p.slotNames.size());
+        return slots;
+    }
+
+    Instr decode(const SourceInstr& ins, int slot) {
+        static const std::unordered_map<std::string, Op> simple = {
+            {"HALT", HALT}, {"PUSH_NIL", PUSH_NIL}, {"INDEX", INDEX},
+            {"ADD", ADD}, {"SUB", SUB}, {"MUL", MUL}, {"DIV", DIV}, {"MOD", MOD},
+            {"CMP_EQ", CMP_EQ}, {"CMP_NEQ", CMP_NEQ}, {"CMP_LT", CMP_LT},
+            {"CMP_LTE", CMP_LTE}, {"CMP_GT", CMP_GT}, {"CMP_GTE", CMP_GTE},
+            {"AND", AND}, {"OR", OR}, {"LEN", LEN},
+            {"QUESTION", QUESTION}, {"PRINT", PRINT}, {"PRINT_CONCL", PRINT_CONCL},
+            {"MOV_TOP_R0", MOV_TOP_R0}, {"MOV_TOP_R1", MOV_TOP_R1},
+            {"PUSH_R0", PUSH_R0}, {"PUSH_R1", PUSH_R1},
+        };
+        static const std::unordered_map<std::string, Op> variables = {
+            {"LOAD", LOAD}, {"LOAD_SLOT", LOAD}, {"STORE", STORE}, {"STORE_SLOT", STORE},
+            {"APPEND", APPEND}, {"APPEND_SLOT", APPEND}, {"STORE_INDEX", STORE_INDEX},
+            {"STORE_INDEX_SLOT", STORE_INDEX}, {"INPUT", INPUT}, {"INPUT_SLOT", INPUT},
+        };
+
+        const std::string& op = ins.op;
+        const std::string* arg = ins.args.empty() ? nullptr : &ins.args[0];
+        auto found = simple.find(op);
+        if (found != simple.end()) return {found->second};
+        found = variables.find(op);
+        if (found != variables.end()) {
+            if (slot < 0) return {NOTICE, message("[VM] " + op + " sem argumento")};
+            return {found->second, slot};
+        }
+
+        long n;
+        if (op == "PUSH_NUM") {
+            if (!arg) return {NOTICE, message("[VM] PUSH_NUM sem argumento")};
+            return {PUSH_CONST, constant(rt::num(parseNumber(*arg)))};
+        }
+        if (op == "PUSH_BOOL") {
+            if (!arg) return {NOTICE, message("[VM] PUSH_BOOL sem argumento")};
+            if (!parseInt(*arg, n)) return {FAIL, message("ValueError: invalid literal for int() with base 10: '" + *arg + "'")};
+            return {PUSH_CONST, constant(rt::boolean(n != 0))};
+        }
+        if (op == "PUSH_STR") return {PUSH_CONST, constant(rt::str(parseStringLiteral(*arg)))};
+        if (op == "BUILD_LIST") {
+            if (!arg) return {ABORT, message("[VM] BUILD_LIST sem argumento")};
+            if (!parseInt(*arg, n)) return {FAIL, message("ValueError: invalid literal for int() with base 10: '" + *arg + "'")};
+            return {BUILD_LIST, (int)std::max(n, 0L)};
+        }
+        if (op == "JUMP" || op == "JUMP_IF_FALSE" || op == "JUMP_IF_TRUE") {
+            if (!arg) return {ABORT, message("[VM] " + op + " sem destino")};
+            auto target = labels.find(*arg);
+            if (op == "JUMP") {
+                if (target == labels.end()) return {ABORT, message("[VM] Label não encontrado: " + *arg)};
+                return {JUMP, target->second};
+            }
+            // Salto condicional para label inexistente só falha se for tomado
+            return {op == "JUMP_IF_FALSE" ? JUMP_IF_FALSE : JUMP_IF_TRUE, target == labels.end() ? -1 : target->second};
+        }
+        if (op == "READ_SENSOR") {
+            if (!arg) return {NOTICE, message("[VM] READ_SENSOR sem nome")};
+            if (*arg == "time") return {SENSOR_TIME};
+            if (*arg == "rand") return {SENSOR_RAND};
+            return {NOTICE_NIL, message("[VM] Sensor desconhecido: " + *arg)};
+        }
+        return {NOTICE, message("[VM] Instrução desconhecida: " + op)};
+    }
+
+public:
+    explicit Loader(Program& program) : p(program) {}
+
+    bool load(const char* filename) {
+        std::ifstream in(filename, std::ios::binary);
+        if (!in) return false;
+        std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        parseLines(text);
+        std::vector<int> slots = resolveSlots();
+        p.code.reserve(p.source.size() + 1);
+        for (size_t i = 0; i < p.source.size(); ++i) p.code.push_back(decode(p.source[i], slots[i]));
+        p.code.push_back({END});
+        return true;
+    }
+
+    // Verificação de carregamento (verify_program da VM em Python):
+    // instruções conhecidas com o número certo de operandos, literais bem
+    // formados, labels existentes e a mesma profundidade de pilha por todos
+    // os caminhos, sem nunca tirar da pilha mais do que ela tem. Guarda a
+    // profundidade máxima em p.maxDepth; os problemas vão em `problems`,
+    // com o texto da VM em Python.
+    bool verify(std::vector<std::string>& problems) {
+        // Efeito na pilha: valores que consome e que empilha (BUILD_LIST: -1,
+        // consome o operando) e se tem operando
+        struct Effect { int pops, pushes; bool arg; };
+        static const std::unordered_map<std::string, Effect> effects = {
+            {"PUSH_NUM", {0, 1, true}}, {"PUSH_BOOL", {0, 1, true}}, {"PUSH_STR", {0, 1, true}},
+            {"PUSH_NIL", {0, 1, false}}, {"LOAD", {0, 1, true}}, {"LOAD_SLOT", {0, 1, true}},
+            {"PUSH_R0", {0, 1, false}}, {"PUSH_R1", {0, 1, false}}, {"READ_SENSOR", {0, 1, true}},
+            {"STORE", {1, 0, true}}, {"STORE_SLOT", {1, 0, true}},
+            {"APPEND", {1, 0, true}}, {"APPEND_SLOT", {1, 0, true}},
+            {"STORE_INDEX", {2, 0, true}}, {"STORE_INDEX_SLOT", {2, 0, true}},
+            {"INPUT", {0, 0, true}}, {"INPUT_SLOT", {0, 0, true}},
+            {"INDEX", {2, 1, false}}, {"LEN", {1, 1, false}}, {"BUILD_LIST", {-1, 1, true}},
+            {"ADD", {2, 1, false}}, {"SUB", {2, 1, false}}, {"MUL", {2, 1, false}},
+            {"DIV", {2, 1, false}}, {"MOD", {2, 1, false}},
+            {"CMP_EQ", {2, 1, false}}, {"CMP_NEQ", {2, 1, false}}, {"CMP_LT", {2, 1, false}},
+            {"CMP_LTE", {2, 1, false}}, {"CMP_GT", {2, 1, false}}, {"CMP_GTE", {2, 1, false}},
+            {"AND", {2, 1, false}}, {"OR", {2, 1, false}},
+            {"QUESTION", {1, 0, false}}, {"PRINT", {1, 0, false}}, {"PRINT_CONCL", {1, 0, false}},
+            {"MOV_TOP_R0", {1, 0, false}}, {"MOV_TOP_R1", {1, 0, false}},
+            {"JUMP", {0, 0, true}}, {"JUMP_IF_FALSE", {1, 0, true}}, {"JUMP_IF_TRUE", {1, 0, true}},
+            {"HALT", {0, 0, false}},
+        };
+
+        const size_t n = p.source.size();
+        auto problem = [&](size_t pc, const std::string& msg) {
+            problems.push_back("[PC=" + std::to_string(pc) + "] " + p.source[pc].op + ": " + msg);
+        };
+
+        std::vector<const Effect*> effect(n);
+        for (size_t pc = 0; pc < n; ++pc) {
+            const SourceInstr& ins = p.source[pc];
+            auto found = effects.find(ins.op);
+            if (found == effects.end()) {
+                problem(pc, "instrução desconhecida");
+                continue;
+            }
+            effect[pc] = &found->second;
+            size_t expected = found->second.arg ? 1 : 0;
+            if (ins.args.size() != expected) {
+                problem(pc, "espera " + std::to_string(expected) + " operando(s), tem " + std::to_string(ins.args.size()));
+                continue;
+            }
+            long count;
+            const std::string& op = ins.op;
+            if (op == "PUSH_NUM" && !validNumber(ins.args[0])) {
+                problem(pc, "número inválido: " + ins.args[0]);
+            } else if (op == "PUSH_BOOL" && !parseInt(ins.args[0], count)) {
+                problem(pc, "booleano inválido: " + ins.args[0]);
+            } else if (op == "PUSH_STR" && !wellFormedString(ins.args[0])) {
+                problem(pc, "literal de string malformado: " + ins.args[0]);
+            } else if (op == "BUILD_LIST" && (!parseInt(ins.args[0], count) || count < 0)) {
+                problem(pc, "tamanho inválido: " + ins.args[0]);
+            } else if ((op == "JUMP" || op == "JUMP_IF_FALSE" || op == "JUMP_IF_TRUE") && !labels.count(ins.args[0])) {
+                problem(pc, "label não encontrado: " + ins.args[0]);
+            } else if (op == "READ_SENSOR" && ins.args[0] != "time" && ins.args[0] != "rand") {
+                problem(pc, "sensor desconhecido: " + ins.args[0]);
+            }
+        }
+        if (!problems.empty() || n == 0) return problems.empty();
+
+        // Profundidade da pilha na entrada de cada instrução alcançável
+        std::vector<long> depth(n + 1, -1);   // +1: fim do programa
+        std::vector<size_t> work{0};
+        depth[0] = 0;
+        while (!work.empty() && problems.empty()) {
+            size_t pc = work.back();
+            work.pop_back();
+            if (pc == n) continue;
+            const Instr& ins = p.code[pc];
+            int pops = effect[pc]->pops < 0 ? ins.arg : effect[pc]->pops;
+            long d = depth[pc];
+            if (d < pops) {
+                problem(pc, "pilha com " + std::to_string(d) + " valor(es), precisa de " + std::to_string(pops));
+                break;
+            }
+            d += effect[pc]->pushes - pops;
+            p.maxDepth = std::max(p.maxDepth, (size_t)d);
+
+            size_t successors[2];
+            int count = 0;
+            if (ins.op == JUMP || ins.op == JUMP_IF_FALSE || ins.op == JUMP_IF_TRUE) successors[count++] = ins.arg;
+            if (ins.op != JUMP && ins.op != HALT) successors[count++] = pc + 1;
+            for (int i = 0; i < count; ++i) {
+                size_t next = successors[i];
+                if (depth[next] < 0) {
+                    depth[next] = d;
+                    work.push_back(next);
+                } else if (depth[next] != d) {
+                    problem(pc, "chega ao PC=" + std::to_string(next) + " com " + std::to_string(d)
+                                + " valor(es) na pilha, outro caminho com " + std::to_string(depth[next]));
+                    break;
+                }
+            }
+        }
+        if (problems.empty() && p.stackSize >= 0 && (size_t)p.stackSize < p.maxDepth) {
+            problems.push_back(".STACK " + std::to_string(p.stackSize) + " menor que a profundidade calculada ("
+                               + std::to_string(p.maxDepth) + ")");
+        }
+        return problems.empty();
+    }
+};
+
+// -------------------- Perfil (--profile-out) --------------------
+
+inline const char* typeName(const Value& v) {
+    static const char* const names[] = {"NIL", "BOOL", "NUMBER", "STRING", "LIST"};
+    return names[v.type];
+}
+
+// Mesmo formato do Profile da VM em Python: contadores por instrução,
+// agregados nos sites (.SITE) que o compilador marcou
+struct Profile {
+    std::vector<long> counts, truths;
+    std::vector<std::map<std::string, long>> types;
+
+    explicit Profile(size_t size) : counts(size), truths(size), types(size) {}
+
+    void operandTypes(size_t pc, const Value& a, const Value& b) {
+        ++types[pc][std::string(typeName(a)) + "/" + typeName(b)];
+    }
+
+    bool write(const char* filename, const Program& p, const char* source) const {
+        std::vector<std::string> order;
+        std::unordered_map<std::string, std::array<long, 3>> sites;
+        for (size_t pc = 0; pc < p.source.size(); ++pc) {
+            const SourceInstr& ins = p.source[pc];
+            for (const std::string& key : ins.sites) {
+                auto it = sites.find(key);
+                if (it == sites.end()) {
+                    it = sites.emplace(key, std::array<long, 3>{0, 0, 0}).first;
+                    order.push_back(key);
+                }
+                it->second[0] += counts[pc];
+                if (ins.op == "JUMP_IF_FALSE" || ins.op == "JUMP_IF_TRUE") {
+                    it->second[1] += truths[pc];
+                    it->second[2] += counts[pc] - truths[pc];
+                }
+            }
+        }
+
+        std::ostringstream out;
+        out << "# Perfil da SocraticVM: " << source << "\n";
+        if (!p.sourceHash.empty()) out << "source " << p.sourceHash << "\n";   // o compilador só usa o perfil com o mesmo fonte
+        out << "# site <chave> <execuções> <condição verdadeira> <condição falsa>\n";
+        for (const std::string& key : order) {
+            const auto& t = sites.at(key);
+            out << "site " << key << " " << t[0] << " " << t[1] << " " << t[2] << "\n";
+        }
+        out << "# instr <pc> <op> <execuções> [<tipos>=<vezes> ...]\n";
+        for (size_t pc = 0; pc < p.source.size(); ++pc) {
+            out << "instr " << pc << " " << p.source[pc].op << " " << counts[pc];
+            for (const auto& [key, count] : types[pc]) out << " " << key << "=" << count;
+            out << "\n";
+        }
+        std::ofstream f(filename, std::ios::binary);
+        f << out.str();
+        return (bool)f;
+    }
+};
+
+// -------------------- Estatísticas (--stats) --------------------
+
+// Classe de uma instrução do .asm, como nas seções de docs/SocraticVM.md
+inline const char* opClass(const std::string& op) {
+    static const std::unordered_map<std::string, const char*> classes = {
+        {"PUSH_NUM", "pilha"}, {"PUSH_BOOL", "pilha"}, {"PUSH_STR", "pilha"}, {"PUSH_NIL", "pilha"},
+        {"LOAD", "variáveis"}, {"LOAD_SLOT", "variáveis"}, {"STORE", "variáveis"}, {"STORE_SLOT", "variáveis"},
+        {"APPEND", "listas"}, {"APPEND_SLOT", "listas"}, {"STORE_INDEX", "listas"},
+        {"STORE_INDEX_SLOT", "listas"}, {"INDEX", "listas"}, {"LEN", "listas"}, {"BUILD_LIST", "listas"},
+        {"ADD", "aritmética"}, {"SUB", "aritmética"}, {"MUL", "aritmética"}, {"DIV", "aritmética"},
+        {"MOD", "aritmética"},
+        {"CMP_EQ", "comparação"}, {"CMP_NEQ", "comparação"}, {"CMP_LT", "comparação"},
+        {"CMP_LTE", "comparação"}, {"CMP_GT", "comparação"}, {"CMP_GTE", "comparação"},
+        {"AND", "lógica"}, {"OR", "lógica"},
+        {"JUMP", "controle"}, {"JUMP_IF_FALSE", "controle"}, {"JUMP_IF_TRUE", "controle"}, {"HALT", "controle"},
+        {"MOV_TOP_R0", "registradores"}, {"MOV_TOP_R1", "registradores"},
+        {"PUSH_R0", "registradores"}, {"PUSH_R1", "registradores"},
+        {"QUESTION", "E/S"}, {"PRINT", "E/S"}, {"PRINT_CONCL", "E/S"}, {"INPUT", "E/S"},
+        {"INPUT_SLOT", "E/S"}, {"READ_SENSOR", "E/S"},
+    };
+    auto it = classes.find(op);
+    return it == classes.end() ? "outras" : it->second;
+}
+
+// Contadores do --stats: execuções e tempo de cada instrução, pilha máxima
+// e variáveis que receberam valor. O tempo entre duas instruções observadas
+// é cobrado da primeira (uma leitura do relógio por instrução), então ele
+// inclui o custo da própria observação; vale para comparar as classes
+// entre si, não como tempo absoluto.
+struct Stats {
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<long> counts;
+    std::vector<Clock::duration> times;
+    std::vector<bool> created;   // por slot
+    size_t peakDepth = 0;
+    size_t last = SIZE_MAX;
+    Clock::time_point lastTime = Clock::now();
+
+    Stats(size_t size, size_t slotCount) : counts(size), times(size), created(slotCount) {}
+
+    void observe(size_t pc, const Instr& ins, size_t depth) {
+        Clock::time_point now = Clock::now();
+        if (last != SIZE_MAX) times[last] += now - lastTime;
+        lastTime = now;
+        last = pc;
+        ++counts[pc];
+        peakDepth = std::max(peakDepth, depth);
+        if (ins.op == STORE || ins.op == APPEND || ins.op == STORE_INDEX || ins.op == INPUT) created[ins.arg] = true;
+    }
+
+    // Fim da execução: a última instrução recebe o tempo até aqui
+    void finish() {
+        if (last != SIZE_MAX) times[last] += Clock::now() - lastTime;
+        last = SIZE_MAX;
+    }
+
+    void print(std::FILE* out, const Program& p, size_t top) const {
+        auto ms = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+        auto percent = [](double part, double total) { return total > 0 ? 100.0 * part / total : 0.0; };
+
+        long total = 0;
+        Clock::duration elapsed{};
+        std::map<std::string, long> byOp;
+        std::map<std::string, std::pair<long, Clock::duration>> byClass;
+        for (size_t pc = 0; pc < counts.size(); ++pc) {
+            if (!counts[pc]) continue;
+            total += counts[pc];
+            elapsed += times[pc];
+            byOp[p.source[pc].op] += counts[pc];
+            auto& c = byClass[opClass(p.source[pc].op)];
+            c.first += counts[pc];
+            c.second += times[pc];
+        }
+
+        std::fprintf(out, "[VM] Estatísticas da execução\n");
+        std::fprintf(out, "  instruções executadas: %ld\n", total);
+        std::fprintf(out, "  tempo nas instruções: %.3f ms\n", ms(elapsed));
+        std::fprintf(out, "  pilha máxima: %zu\n", peakDepth);
+        std::fprintf(out, "  variáveis criadas: %zu de %zu\n",
+                     (size_t)std::count(created.begin(), created.end(), true), created.size());
+
+        // mais frequentes primeiro; empates em ordem alfabética
+        std::vector<std::pair<std::string, long>> ops(byOp.begin(), byOp.end());
+        std::stable_sort(ops.begin(), ops.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+        std::fprintf(out, "  execuções por opcode:\n");
+        for (const auto& [op, count] : ops)
+            std::fprintf(out, "    %-18s %12ld %6.2f%%\n", op.c_str(), count, percent(count, total));
+
+        std::vector<std::pair<std::string, std::pair<long, Clock::duration>>> classes(byClass.begin(), byClass.end());
+        std::stable_sort(classes.begin(), classes.end(),
+                         [](const auto& a, const auto& b) { return a.second.second > b.second.second; });
+        std::fprintf(out, "  tempo por classe:\n");
+        for (const auto& [name, c] : classes) {
+            // "%-14s" conta bytes: acerta a coluna dos nomes acentuados
+            int pad = 14 + (int)std::count_if(name.begin(), name.end(), [](char c) { return (c & 0xC0) == 0x80; });
+            std::fprintf(out, "    %-*s %12.3f ms %6.2f%% %12ld instruções\n", pad, name.c_str(), ms(c.second),
+                         percent(ms(c.second), ms(elapsed)), c.first);
+        }
+
+        std::vector<size_t> hot;
+        for (size_t pc = 0; pc < counts.size(); ++pc)
+            if (counts[pc]) hot.push_back(pc);
+        std::stable_sort(hot.begin(), hot.end(), [&](size_t a, size_t b) { return counts[a] > counts[b]; });
+        if (hot.size() > top) hot.resize(top);
+        std::fprintf(out, "  instruções mais executadas:\n");
+        for (size_t pc : hot) {
+            std::string line = "[PC=" + std::to_string(pc) + "] " + p.source[pc].op;
+            for (const std::string& a : p.source[pc].args) line += " " + a;
+            std::fprintf(out, "    %12ld  %s\n", counts[pc], line.c_str());
+        }
+    }
+};
+
+// -------------------- Trace em anel (--trace-ring) --------------------
+
+// Um evento por instrução executada: PC, opcode decodificado e o tipo do
+// valor no topo da pilha antes da instrução (EMPTY_TAG: pilha vazia)
+struct TraceEvent {
+    uint32_t pc;
+    uint8_t op;
+    uint8_t tag;
+    uint16_t reserved;
+};
+
+// Cabeçalho do arquivo, seguido dos eventos guardados, do mais antigo ao
+// mais recente (na ordem de bytes da máquina que gravou)
+struct TraceHeader {
+    char magic[8];       // "SVMTRACE"
+    uint32_t version;    // 1
+    uint32_t capacity;   // eventos no anel
+    int32_t reason;      // 0: fim do processo; senão, o sinal que o encerrou
+    uint32_t reserved;
+    uint64_t count;      // eventos registrados ao todo (no arquivo: os últimos `capacity`)
+};
+
+// Os últimos `capacity` eventos (potência de 2) ficam num vetor fixo em
+// memória; registrar um é uma escrita de 8 bytes, sem formatação nem E/S.
+// O arquivo é aberto no início e gravado uma vez: no fim do processo
+// (inclusive por rt::fatal) ou num sinal fatal. O tratador de sinal só lê o
+// descritor guardado no construtor e a marca de já gravado, e só chama
+// write(), que pode ser chamado de dentro dele.
+class TraceRing {
+    std::vector<TraceEvent> events;
+    uint64_t mask, count = 0;
+    std::FILE* file;
+#if VM_POSIX
+    int fd;
+#endif
+    volatile std::sig_atomic_t dumped = 0;
+
+    void writeAll(const void* data, size_t size) {
+#if VM_POSIX
+        const char* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t written = ::write(fd, bytes, size);
+            if (written <= 0) return;
+            bytes += written;
+            size -= (size_t)written;
+        }
+#else
+        std::fwrite(data, 1, size, file);
+#endif
+    }
+
+public:
+    static constexpr uint8_t EMPTY_TAG = 0xFF;
+
+    TraceRing(std::FILE* out, size_t capacity) : events(capacity), mask(capacity - 1), file(out) {
+#if VM_POSIX
+        fd = fileno(out);
+#endif
+    }
+
+    void record(size_t pc, Op op, uint8_t tag) {
+        events[count++ & mask] = {(uint32_t)pc, op, tag, 0};
+    }
+
+    void dump(int reason) {
+        if (dumped) return;
+        dumped = 1;
+        TraceHeader header{{'S', 'V', 'M', 'T', 'R', 'A', 'C', 'E'}, 1, (uint32_t)events.size(), reason, 0, count};
+        writeAll(&header, sizeof header);
+        size_t capacity = events.size();
+        if (count <= capacity) {
+            writeAll(events.data(), count * sizeof(TraceEvent));
+        } else {
+            size_t oldest = count & mask;
+            writeAll(events.data() + oldest, (capacity - oldest) * sizeof(TraceEvent));
+            writeAll(events.data(), oldest * sizeof(TraceEvent));
+        }
+#if !VM_POSIX
+        std::fflush(file);
+#endif
+    }
+};
+
+inline TraceRing* activeRing = nullptr;
+
+inline void dumpRingAtExit() {
+    if (activeRing) activeRing->dump(0);
+}
+
+#if VM_POSIX
+extern "C" inline void dumpRingOnSignal(int sig) {
+    if (activeRing) activeRing->dump(sig);
+    std::signal(sig, SIG_DFL);
+    std::raise(sig);
+}
+#endif
+
+inline void installRing(TraceRing* ring) {
+    activeRing = ring;
+    std::atexit(dumpRingAtExit);
+#if VM_POSIX
+    for (int sig : {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT, SIGINT, SIGTERM, SIGHUP}) {
+        std::signal(sig, dumpRingOnSignal);
+    }
+#endif
+}
+
+// --trace-decode: os eventos gravados, no formato do --trace, na saída padrão
+inline int decodeRing(const Program& p, const char* filename, bool tags) {
+    std::ifstream in(filename, std::ios::binary);
+    TraceHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof header) || std::memcmp(header.magic, "SVMTRACE", 8) != 0
+        || header.version != 1) {
+        std::fprintf(stderr, "[VM] Arquivo de trace inválido: %s\n", filename);
+        return 1;
+    }
+    uint64_t stored = std::min<uint64_t>(header.count, header.capacity);
+    std::string out;
+    for (uint64_t i = 0; i < stored; ++i) {
+        TraceEvent e;
+        if (!in.read(reinterpret_cast<char*>(&e), sizeof e)) {
+            std::fprintf(stderr, "[VM] Trace truncado: %s\n", filename);
+            return 1;
+        }
+        if (e.pc >= p.source.size() || e.op != p.code[e.pc].op) {
+            std::fprintf(stderr, "[VM] O trace não corresponde ao programa (evento %llu: PC=%u %s)\n",
+                         (unsigned long long)i, (unsigned)e.pc, opName(e.op));
+            return 1;
+        }
+        out = "[PC=" + std::to_string(e.pc) + "] " + p.source[e.pc].op;
+        for (const std::string& a : p.source[e.pc].args) out += " " + a;
+        if (tags) {
+            static const char* const names[] = {"NIL", "BOOL", "NUMBER", "STRING", "LIST"};
+            out += "    ; topo: ";
+            out += e.tag < 5 ? names[e.tag] : "vazio";
+        }
+        rt::message(out.c_str());
+    }
+    std::fprintf(stderr, "[VM] Trace: %llu instruções executadas, %llu no arquivo; ",
+                 (unsigned long long)header.count, (unsigned long long)stored);
+    if (header.reason == 0) std::fprintf(stderr, "fim do processo\n");
+    else std::fprintf(stderr, "encerrado pelo sinal %d\n", header.reason);
+    return 0;
+}
+
+// -------------------- Amostragem (--sample-out) --------------------
+
+// A cada intervalo de tempo de CPU (SIGPROF), o tratador do sinal conta
+// uma amostra para o PC que o laço de execução publicou em samplePc; o
+// vetor de contagens é alocado antes, e o tratador só incrementa.
+inline volatile size_t samplePc = 0;
+inline std::vector<uint32_t>* sampleCounts = nullptr;
+
+#if VM_POSIX
+extern "C" inline void takeSample(int) {
+    size_t pc = samplePc;
+    if (sampleCounts && pc < sampleCounts->size()) ++(*sampleCounts)[pc];
+}
+#endif
+
+inline bool startSampling(std::vector<uint32_t>& counts, long hz) {
+#if VM_POSIX
+    sampleCounts = &counts;
+    std::signal(SIGPROF, takeSample);
+    long usec = std::max(1000000 / std::max(hz, 1L), 1L);
+    timeval interval{usec / 1000000, usec % 1000000};
+    itimerval timer{interval, interval};
+    return setitimer(ITIMER_PROF, &timer, nullptr) == 0;
+#else
+    (void)counts;
+    (void)hz;
+    return false;
+#endif
+}
+
+inline void stopSampling() {
+#if VM_POSIX
+    itimerval off{};
+    setitimer(ITIMER_PROF, &off, nullptr);
+    sampleCounts = nullptr;
+#endif
+}
+
+// Amostras agregadas pelas linhas do fonte (sem tabela de linhas, cada
+// instrução é a sua própria pilha): "pilha contagem", o formato "folded"
+// dos geradores de flame graph
+inline bool writeSamples(const char* filename, const Program& p, const std::vector<uint32_t>& counts) {
+    std::map<std::string, unsigned long> stacks;
+    for (size_t pc = 0; pc < p.source.size(); ++pc) {
+        if (!counts[pc]) continue;
+        const SourceInstr& ins = p.source[pc];
+        stacks[ins.lines >= 0 ? p.lineStacks[ins.lines] : "[PC=" + std::to_string(pc) + "] " + ins.op] += counts[pc];
+    }
+    std::ofstream f(filename, std::ios::binary);
+    for (const auto& [stack, count] : stacks) f << stack << " " << count << "\n";
+    return (bool)f;
+}
+
+// -------------------- Execução --------------------
+
+inline void underflow(int needed) {
+    rt::message(("[VM] Erro: pilha com menos de " + std::to_string(needed) + " elementos").c_str());
+}
+
+// O que a instância observada do laço faz a cada instrução
+struct Observers {
+    Profile* profile = nullptr;   // --profile-out
+    bool trace = false;           // --trace
+    TraceRing* ring = nullptr;    // --trace-ring
+    bool sampling = false;        // --sample-out
+    Stats* stats = nullptr;       // --stats
+
+    bool any() const { return profile || trace || ring || sampling || stats; }
+};
+
+// Observed: conta execuções (perfil e --stats), escreve o --trace, registra
+// no trace em anel e publica o PC para a amostragem; a instância sem
+// observação não paga nenhum teste por instrução.
+// Verified: o programa passou por Loader::verify, e a pilha, alocada com
+// p.maxDepth valores, nunca fica curta nem transborda; a instância não
+// verificada testa as duas coisas a cada instrução.
+template <bool Observed, bool Verified>
+void run(const Program& p, const Observers& observers) {
+    Profile* const profile = observers.profile;
+    const bool trace = observers.trace;
+    TraceRing* const ring = observers.ring;
+    const bool sampling = observers.sampling;
+    Stats* const stats = observers.stats;
+    const Instr* code = p.code.data();
+    const size_t n = p.source.size();
+    std::vector<Value> slots(p.slotCount);
+    // A pilha vai de base (fundo) a sp (um além do topo). Sem verificação,
+    // começa com o .STACK do cabeçalho (ou 256) e cresce se precisar.
+    std::vector<Value> stack(Verified ? std::max(p.maxDepth, (size_t)1)
+                                      : p.stackSize > 0 ? (size_t)p.stackSize : 256);
+    Value* base = stack.data();
+    Value* sp = base;
+    Value* limit = base + stack.size();
+    auto grow = [&] {
+        size_t depth = sp - base;
+        stack.resize(stack.size() * 2);
+        base = stack.data();
+        sp = base + depth;
+        limit = base + stack.size();
+    };
+    Value reg0, reg1;
+    auto start = std::chrono::system_clock::now();
+    std::mt19937_64 rng{std::random_device{}()};
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    size_t pc = 0;
+    const Instr* ins;
+
+#define VM_NEED(count)                                  \
+    if (!Verified && sp - base < (long)(count)) {       \
+        underflow(count);                               \
+        return;                                         \
+    }
+#define VM_PUSH(value)                                  \
+    do {                                                \
+        if (!Verified && sp == limit) grow();           \
+        *sp++ = value;                                  \
+    } while (0)
+#define VM_BINARY(expr)                            \
+    {                                              \
+        VM_NEED(2);                                \
+        Value& a = sp[-2];                         \
+        const Value& b = sp[-1];                   \
+        if (Observed && profile) profile->operandTypes(pc, a, b); \
+        expr;                                      \
+        --sp;                                      \
+        ++pc;                                      \
+        VM_NEXT();                                 \
+    }
+
+#if VM_THREADED
+    static const void* const handlers[] = {
+#define VM_LABEL(name) &&L_##name,
+        VM_OPCODES(VM_LABEL)
+#undef VM_LABEL
+    };
+#define VM_CASE(name) L_##name:
+#define VM_NEXT()                      \
+    do {                               \
+        ins = &code[pc];               \
+        if (Observed) observe(pc);     \
+        goto* handlers[ins->op];       \
+    } while (0)
+#else
+#define VM_CASE(name) case name:
+#define VM_NEXT() goto dispatch
+#endif
+
+    auto observe = [&](size_t at) {
+        if (at >= n) return;
+        if (ring) ring->record(at, code[at].op, sp > base ? (uint8_t)sp[-1].type : TraceRing::EMPTY_TAG);
+        if (sampling) samplePc = at;
+        if (profile) ++profile->counts[at];
+        if (stats) stats->observe(at, code[at], sp - base);
+        if (trace) {
+            std::string line = "[PC=" + std::to_string(at) + "] " + p.source[at].op;
+            for (const std::string& a : p.source[at].args) line += " " + a;
+            std::fprintf(stderr, "%s\n", line.c_str());
+        }
+    };
+
+#if VM_THREADED
+    VM_NEXT();
+#else
+dispatch:
+    ins = &code[pc];
+    if (Observed) observe(pc);
+    switch (ins->op) {
+#endif
+
+    VM_CASE(HALT) return;
+    VM_CASE(END) return;
+
+    VM_CASE(PUSH_CONST)
+        VM_PUSH(p.constants[ins->arg]);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(PUSH_NIL)
+        VM_PUSH(Value());
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(LOAD)
+        VM_PUSH(slots[ins->arg]);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(STORE)
+        VM_NEED(1);
+        slots[ins->arg] = std::move(*--sp);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(APPEND) {
+        VM_NEED(1);
+        rt::append(slots[ins->arg], std::move(*--sp));
+        ++pc;
+        VM_NEXT();
+    }
+
+    VM_CASE(STORE_INDEX) {
+        VM_NEED(2);
+        sp -= 2;
+        rt::storeIndex(slots[ins->arg], sp[0], std::move(sp[1]), p.slotNames[ins->arg].c_str());
+        ++pc;
+        VM_NEXT();
+    }
+
+    VM_CASE(INDEX) {
+        VM_NEED(2);
+        Value item = rt::index(sp[-2], sp[-1]);
+        --sp;
+        sp[-1] = std::move(item);
+        ++pc;
+        VM_NEXT();
+    }
+
+    // Operandos numéricos (o caso comum) são calculados no lugar
+    VM_CASE(ADD) VM_BINARY(
+        if (a.type == Value::NUMBER && b.type == Value::NUMBER) a.numVal += b.numVal;
+        else if (a.type == Value::STRING) rt::appendString(a.strVal, b);
+        else a = rt::add(a, b))
+    VM_CASE(SUB) VM_BINARY(if (a.type == Value::NUMBER) a.numVal -= b.numVal; else a = rt::sub(a, b))
+    VM_CASE(MUL) VM_BINARY(if (a.type == Value::NUMBER) a.numVal *= b.numVal; else a = rt::mul(a, b))
+    VM_CASE(DIV) VM_BINARY(a = rt::div(a, b))
+    VM_CASE(MOD) VM_BINARY(a = rt::mod(a, b))
+    VM_CASE(CMP_EQ) VM_BINARY(a = rt::eq(a, b))
+    VM_CASE(CMP_NEQ) VM_BINARY(a = rt::neq(a, b))
+    VM_CASE(CMP_LT) VM_BINARY(a = rt::lt(a, b))
+    VM_CASE(CMP_LTE) VM_BINARY(a = rt::lte(a, b))
+    VM_CASE(CMP_GT) VM_BINARY(a = rt::gt(a, b))
+    VM_CASE(CMP_GTE) VM_BINARY(a = rt::gte(a, b))
+    VM_CASE(AND) VM_BINARY(a = rt::logicalAnd(a, b))
+    VM_CASE(OR) VM_BINARY(a = rt::logicalOr(a, b))
+
+    VM_CASE(LEN)
+        VM_NEED(1);
+        sp[-1] = rt::len(sp[-1]);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(BUILD_LIST) {
+        VM_NEED(ins->arg);
+        sp -= ins->arg;
+        rt::List items(std::make_move_iterator(sp), std::make_move_iterator(sp + ins->arg));
+        VM_PUSH(rt::list(std::move(items)));
+        ++pc;
+        VM_NEXT();
+    }
+
+    VM_CASE(QUESTION)
+        VM_NEED(1);
+        --sp;
+        rt::print("[?] ", *sp);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(PRINT)
+        VM_NEED(1);
+        --sp;
+        rt::print(">> ", *sp);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(PRINT_CONCL)
+        VM_NEED(1);
+        --sp;
+        rt::print("! ", *sp);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(INPUT)
+        rt::input(slots[ins->arg]);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(JUMP)
+        pc = ins->arg;
+        VM_NEXT();
+
+    VM_CASE(JUMP_IF_FALSE)
+    VM_CASE(JUMP_IF_TRUE) {
+        VM_NEED(1);
+        bool truth = rt::truthy(*--sp);
+        if (Observed && profile && truth) ++profile->truths[pc];
+        if (truth != (ins->op == JUMP_IF_TRUE)) {
+            ++pc;
+            VM_NEXT();
+        }
+        if (!Verified && ins->arg < 0) {
+            rt::message(("[VM] Label não encontrado: " + p.source[pc].args[0]).c_str());
+            return;
+        }
+        pc = ins->arg;
+        VM_NEXT();
+    }
+
+    // Registradores
+    VM_CASE(MOV_TOP_R0)
+        VM_NEED(1);
+        reg0 = std::move(*--sp);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(MOV_TOP_R1)
+        VM_NEED(1);
+        reg1 = std::move(*--sp);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(PUSH_R0)
+        VM_PUSH(reg0);
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(PUSH_R1)
+        VM_PUSH(reg1);
+        ++pc;
+        VM_NEXT();
+
+    // Sensores
+    VM_CASE(SENSOR_TIME) {
+        std::chrono::duration<double> elapsed = std::chrono::system_clock::now() - start;
+        VM_PUSH(rt::num(elapsed.count()));
+        ++pc;
+        VM_NEXT();
+    }
+
+    VM_CASE(SENSOR_RAND)
+        VM_PUSH(rt::num(unit(rng)));
+        ++pc;
+        VM_NEXT();
+
+    // Instruções inválidas
+    VM_CASE(NOTICE)
+        rt::message(p.messages[ins->arg].c_str());
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(NOTICE_NIL)
+        rt::message(p.messages[ins->arg].c_str());
+        VM_PUSH(Value());
+        ++pc;
+        VM_NEXT();
+
+    VM_CASE(ABORT)
+        rt::message(p.messages[ins->arg].c_str());
+        return;
+
+    VM_CASE(FAIL)
+        rt::fatal(p.messages[ins->arg].c_str());
+
+#if !VM_THREADED
+    }
+#endif
+
+#undef VM_NEED
+#undef VM_PUSH
+#undef VM_BINARY
+#undef VM_CASE
+#undef VM_NEXT
+}
+
+} // namespace vm
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::printf("Uso: %s programa.asm [--trace] [--profile-out=arquivo] [--verify]\n"
+                    "       [--trace-ring=arquivo] [--trace-ring-size=eventos] [--trace-decode=arquivo [--tags]]\n"
+                    "       [--sample-out=arquivo] [--sample-hz=N] [--stats[=N]]\n",
+                    argv[0]);
+        return 1;
+    }
+
+    const char* filename = argv[1];
+    bool trace = false, verify = false, tags = false, stats = false;
+    size_t statsTop = 10;
+    const char* profileOut = nullptr;
+    const char* ringOut = nullptr;
+    const char* ringIn = nullptr;
+    const char* sampleOut = nullptr;
+    size_t ringSize = 65536;
+    long sampleHz = 1000;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--trace") == 0) trace = true;
+        else if (std::strcmp(argv[i], "--verify") == 0) verify = true;
+        else if (std::strcmp(argv[i], "--tags") == 0) tags = true;
+        else if (std::strcmp(argv[i], "--stats") == 0) stats = true;
+        else if (std::strncmp(argv[i], "--stats=", 8) == 0) {
+            stats = true;
+            statsTop = std::strtoul(argv[i] + 8, nullptr, 10);
+        }
+        else if (std::strncmp(argv[i], "--profile-out=", 14) == 0) profileOut = argv[i] + 14;
+        else if (std::strncmp(argv[i], "--trace-ring=", 13) == 0) ringOut = argv[i] + 13;
+        else if (std::strncmp(argv[i], "--trace-ring-size=", 18) == 0) ringSize = std::strtoul(argv[i] + 18, nullptr, 10);
+        else if (std::strncmp(argv[i], "--trace-decode=", 15) == 0) ringIn = argv[i] + 15;
+        else if (std::strncmp(argv[i], "--sample-out=", 13) == 0) sampleOut = argv[i] + 13;
+        else if (std::strncmp(argv[i], "--sample-hz=", 12) == 0) sampleHz = std::strtol(argv[i] + 12, nullptr, 10);
+    }
+
+    vm::Program program;
+    vm::Loader loader(program);
+    if (!loader.load(filename)) {
+        std::fprintf(stderr, "[VM] Não foi possível abrir o arquivo: %s\n", filename);
+        return 1;
+    }
+
+    std::vector<std::string> problems;
+    bool verified = loader.verify(problems);
+    if (verify) {
+        for (const std::string& problem : problems) rt::message(("[VM] " + problem).c_str());
+        if (!verified) {
+            rt::message(("[VM] Programa não verificado: " + std::to_string(problems.size()) + " problema(s)").c_str());
+            return 1;
+        }
+        rt::message(("[VM] Programa verificado: " + std::to_string(program.source.size())
+                     + " instruções, pilha máxima " + std::to_string(program.maxDepth)).c_str());
+        return 0;
+    }
+    if (ringIn) return vm::decodeRing(program, ringIn, tags);
+
+    // O anel guarda os últimos eventos (potência de 2, no mínimo 16)
+    std::unique_ptr<vm::TraceRing> ring;
+    std::FILE* ringFile = nullptr;
+    if (ringOut) {
+        ringFile = std::fopen(ringOut, "wb");
+        if (!ringFile) {
+            std::fprintf(stderr, "[VM] Não foi possível gravar o trace em %s\n", ringOut);
+            return 1;
+        }
+        size_t capacity = 16;
+        while (capacity < ringSize && capacity < ((size_t)1 << 30)) capacity <<= 1;
+        ring = std::make_unique<vm::TraceRing>(ringFile, capacity);
+        vm::installRing(ring.get());
+    }
+
+    std::vector<uint32_t> samples;
+    bool sampling = false;
+    if (sampleOut) {
+        samples.assign(program.source.size(), 0);
+        sampling = vm::startSampling(samples, sampleHz);
+        if (!sampling) std::fprintf(stderr, "[VM] Amostragem indisponível nesta plataforma\n");
+    }
+
+    // trace, perfil, anel, amostragem e --stats observam cada instrução, e
+    // um programa que não passou na verificação precisa das checagens: vão
+    // pela instância completa
+    std::unique_ptr<vm::Profile> profile;
+    if (profileOut) profile = std::make_unique<vm::Profile>(program.source.size());
+    std::unique_ptr<vm::Stats> statistics;
+    if (stats) statistics = std::make_unique<vm::Stats>(program.source.size(), program.slotCount);
+    vm::Observers observers;
+    observers.profile = profile.get();
+    observers.trace = trace;
+    observers.ring = ring.get();
+    observers.sampling = sampling;
+    observers.stats = statistics.get();
+    if (observers.any()) vm::run<true, false>(program, observers);
+    else if (verified) vm::run<false, true>(program, observers);
+    else vm::run<false, false>(program, observers);
+
+    rt::console.flush();
+    if (statistics) {
+        statistics->finish();
+        statistics->print(stderr, program, statsTop);
+    }
+    if (sampling) {
+        vm::stopSampling();
+        if (!vm::writeSamples(sampleOut, program, samples)) {
+            std::fprintf(stderr, "[VM] Não foi possível gravar as amostras em %s\n", sampleOut);
+            return 1;
+        }
+    }
+    if (ring) {
+        ring->dump(0);
+        vm::activeRing = nullptr;
+        std::fclose(ringFile);
+    }
+    if (profile && !profile->write(profileOut, program, filename)) {
+        std::fprintf(stderr, "[VM] Não foi possível gravar o perfil em %s\n", profileOut);
+        return 1;
+    }
+    return 0;
+}
@@ -4,13 +4,18 @@
 # Uso:
 #   python3 socraticvm.py programa.asm
 #   python3 socraticvm.py programa.asm --trace   # mostra o trace das instruções
+#   python3 socraticvm.py programa.asm --profile-out=perfil.txt   # grava o perfil
+#   python3 socraticvm.py programa.asm --verify  # só verifica o programa
+#   python3 socraticvm.py programa.asm --sample-out=amostras.txt  # perfil por amostragem
+#   python3 socraticvm.py programa.asm --stats   # estatísticas por opcode
 #
 import sys
 import time
 import math
 import random
+import signal
 from dataclasses import dataclass
-from typing import List, Dict, Optional
+from typing import List, Dict, Optional, Tuple
 
 
 class ValueType:
@@ -69,15 +74,53 @@ class Value:
 class Instruction:
     op: str
     args: List[str]
-
+    slot: Optional[int] = None  # slot da variável, resolvido no carregamento
+    sites: Optional[List[str]] = None  # sites de perfil (.SITE) desta instrução
+    lines: Optional[str] = None  # linhas do fonte (.FILE/.LINE), como pilha "folded"
+    # Preenchidos pela verificação (verify_program)
+    target: Optional[int] = None  # destino do salto
+    value: Optional["Value"] = None  # valor de PUSH_NUM, PUSH_BOOL e PUSH_STR
+    count: int = 0  # BUILD_LIST
+
+
+# Instruções que acessam variáveis, por nome ou por slot
+NAMED_VAR_OPS = ("LOAD", "STORE", "APPEND", "STORE_INDEX", "INPUT")
+SLOT_VAR_OPS = ("LOAD_SLOT", "STORE_SLOT", "APPEND_SLOT", "STORE_INDEX_SLOT", "INPUT_SLOT")
+
+# Efeito de cada instrução na pilha: (valores que consome, valores que
+# empilha). BUILD_LIST consome tantos valores quanto o seu operando.
+STACK_EFFECT = {
+    "PUSH_NUM": (0, 1), "PUSH_BOOL": (0, 1), "PUSH_STR": (0, 1), "PUSH_NIL": (0, 1),
+    "LOAD": (0, 1), "LOAD_SLOT": (0, 1), "PUSH_R0": (0, 1), "PUSH_R1": (0, 1),
+    "READ_SENSOR": (0, 1),
+    "STORE": (1, 0), "STORE_SLOT": (1, 0), "APPEND": (1, 0), "APPEND_SLOT": (1, 0),
+    "STORE_INDEX": (2, 0), "STORE_INDEX_SLOT": (2, 0),
+    "INPUT": (0, 0), "INPUT_SLOT": (0, 0),
+    "INDEX": (2, 1), "LEN": (1, 1), "BUILD_LIST": (None, 1),
+    "ADD": (2, 1), "SUB": (2, 1), "MUL": (2, 1), "DIV": (2, 1), "MOD": (2, 1),
+    "CMP_EQ": (2, 1), "CMP_NEQ": (2, 1), "CMP_LT": (2, 1), "CMP_LTE": (2, 1),
+    "CMP_GT": (2, 1), "CMP_GTE": (2, 1), "AND": (2, 1), "OR": (2, 1),
+    "QUESTION": (1, 0), "PRINT": (1, 0), "PRINT_CONCL": (1, 0),
+    "MOV_TOP_R0": (1, 0), "MOV_TOP_R1": (1, 0),
+    "JUMP": (0, 0), "JUMP_IF_FALSE": (1, 0), "JUMP_IF_TRUE": (1, 0), "HALT": (0, 0),
+}
+
+# Instruções com um operando; as demais não têm nenhum
+ONE_ARG_OPS = NAMED_VAR_OPS + SLOT_VAR_OPS + (
+    "PUSH_NUM", "PUSH_BOOL", "PUSH_STR", "BUILD_LIST", "READ_SENSOR",
+    "JUMP", "JUMP_IF_FALSE", "JUMP_IF_TRUE")
 
 # Estado da VM
 stackVM: List[Value] = []
-variables: Dict[str, Value] = {}
+slots: List[Value] = []        # variáveis, indexadas por slot
+slot_names: List[str] = []     # slot -> nome (cabeçalho .SYM)
+symbols: Dict[str, int] = {}   # nome -> slot
 labels: Dict[str, int] = {}
 reg0: Value = Value.nil()   # registrador 0
 reg1: Value = Value.nil()   # registrador 1
 start_time: float = 0.0     # para sensor "time"
+declared_stack: Optional[int] = None  # .STACK do cabeçalho
+source_hash: Optional[str] = None     # .SOURCE_HASH: vai para o perfil
 
 
 def trim(s: str) -> str:
@@ -109,8 +152,46 @@ def parse_string_literal(s: str) -> str:
     return "".join(out)
 
 
+def slot_of(name: str) -> int:
+    slot = symbols.get(name)
+    if slot is None:
+        slot = len(slot_names)
+        symbols[name] = slot
+        slot_names.append(name)
+    return slot
+
+
+def resolve_slots(program: List[Instruction], declared: int) -> None:
+    """
+    Traduz cada acesso a variável para um índice em `slots` e pré-aloca
+    o vetor de variáveis. Acessos por nome (LOAD @x), comuns em assembly
+    escrito à mão, ganham um slot novo se o nome não estiver no cabeçalho.
+    """
+    global slots
+    for ins in program:
+        if not ins.args:
+            continue
+        if ins.op in NAMED_VAR_OPS:
+            ins.slot = slot_of(ins.args[0])
+        elif ins.op in SLOT_VAR_OPS:
+            try:
+                ins.slot = int(ins.args[0])
+            except ValueError:
+                print(f"[VM] Slot inválido em {ins.op}: {ins.args[0]}")
+                sys.exit(1)
+            while ins.slot >= len(slot_names):
+                slot_names.append(f"<slot {len(slot_names)}>")
+    count = max(declared, len(slot_names))
+    slots = [Value.nil() for _ in range(count)]
+
+
 def load_program(filename: str) -> List[Instruction]:
+    global declared_stack, source_hash
     program: List[Instruction] = []
+    declared = 0
+    pending_sites: List[str] = []
+    source_file = "?"
+    source_lines: Optional[str] = None
     with open(filename, "r", encoding="utf-8") as f:
         for line_no, line in enumerate(f, start=1):
             line = trim(line)
@@ -119,6 +200,38 @@ def load_program(filename: str) -> List[Instruction]:
             if line.startswith(";"):
                 continue
 
+            # Cabeçalho da tabela de símbolos: .SLOTS <n> e .SYM <slot> <nome>
+            if line.startswith("."):
+                parts = line.split()
+                if parts[0] == ".SLOTS" and len(parts) == 2:
+                    declared = int(parts[1])
+                elif parts[0] == ".SYM" and len(parts) == 3:
+                    slot = int(parts[1])
+                    while slot >= len(slot_names):
+                        slot_names.append(f"<slot {len(slot_names)}>")
+                    slot_names[slot] = parts[2]
+                    symbols[parts[2]] = slot
+                elif parts[0] == ".STACK" and len(parts) == 2:
+                    # profundidade máxima da pilha, calculada pelo compilador
+                    # (conferida por verify_program)
+                    declared_stack = int(parts[1])
+                elif parts[0] == ".SOURCE_HASH" and len(parts) == 2:
+                    source_hash = parts[1]
+                elif parts[0] == ".SITE" and len(parts) == 2:
+                    # vale para a próxima instrução
+                    pending_sites.append(parts[1])
+                elif parts[0] == ".FILE" and len(parts) >= 2:
+                    # tabela de linhas (-g): fonte das próximas .LINE
+                    source_file = line[len(".FILE"):].strip()
+                elif parts[0] == ".LINE" and len(parts) >= 2 and all(p.isdigit() for p in parts[1:]):
+                    # vale até a próxima .LINE: a linha do comando, depois
+                    # das linhas dos comandos que o contêm
+                    source_lines = ";".join(f"{source_file}:{p}" for p in parts[1:])
+                else:
+                    print(f"[VM] Diretiva inválida na linha {line_no}: {line}")
+                    sys.exit(1)
+                continue
+
             # LABEL só registra endereço
             if line.startswith("LABEL"):
                 parts = line.split()
@@ -140,9 +253,124 @@ def load_program(filename: str) -> List[Instruction]:
                 op = parts[0]
                 args = parts[1:]
                 program.append(Instruction(op=op, args=args))
+            if pending_sites:
+                program[-1].sites = pending_sites
+                pending_sites = []
+            program[-1].lines = source_lines
+    resolve_slots(program, declared)
     return program
 
 
+def well_formed_string(s: str) -> bool:
+    """Literal entre aspas, sem aspas soltas dentro nem escape pela metade."""
+    if len(s) < 2 or s[0] != '"' or s[-1] != '"':
+        return False
+    escape = False
+    for c in s[1:-1]:
+        if escape:
+            escape = False
+        elif c == "\\":
+            escape = True
+        elif c == '"':
+            return False
+    return not escape
+
+
+def verify_program(program: List[Instruction]) -> Tuple[List[str], int]:
+    """
+    Verificação feita uma vez, no carregamento: instruções conhecidas com o
+    número certo de operandos, literais bem formados, labels existentes e
+    a mesma profundidade de pilha por todos os caminhos que chegam a uma
+    instrução, sem nunca tirar da pilha mais do que ela tem. Pré-calcula
+    os destinos dos saltos e os valores das constantes.
+
+    Devolve os problemas encontrados e a profundidade máxima da pilha. Um
+    programa sem problemas roda em exec_verified, sem as verificações por
+    instrução; os demais rodam em exec_program, que as faz.
+    """
+    problems: List[str] = []
+
+    def problem(pc: int, msg: str) -> None:
+        problems.append(f"[PC={pc}] {program[pc].op}: {msg}")
+
+    for pc, ins in enumerate(program):
+        op, args = ins.op, ins.args
+        if op not in STACK_EFFECT:
+            problem(pc, "instrução desconhecida")
+            continue
+        expected = 1 if op in ONE_ARG_OPS else 0
+        if len(args) != expected:
+            problem(pc, f"espera {expected} operando(s), tem {len(args)}")
+            continue
+        if op == "PUSH_NUM":
+            try:
+                ins.value = Value.from_num(float(args[0]))
+            except ValueError:
+                problem(pc, f"número inválido: {args[0]}")
+        elif op == "PUSH_BOOL":
+            try:
+                ins.value = Value.from_bool(bool(int(args[0])))
+            except ValueError:
+                problem(pc, f"booleano inválido: {args[0]}")
+        elif op == "PUSH_STR":
+            if well_formed_string(args[0]):
+                ins.value = Value.from_str(parse_string_literal(args[0]))
+            else:
+                problem(pc, f"literal de string malformado: {args[0]}")
+        elif op == "BUILD_LIST":
+            try:
+                ins.count = int(args[0])
+            except ValueError:
+                ins.count = -1
+            if ins.count < 0:
+                problem(pc, f"tamanho inválido: {args[0]}")
+        elif op in ("JUMP", "JUMP_IF_FALSE", "JUMP_IF_TRUE"):
+            ins.target = labels.get(args[0])
+            if ins.target is None:
+                problem(pc, f"label não encontrado: {args[0]}")
+        elif op == "READ_SENSOR":
+            if args[0] not in ("time", "rand"):
+                problem(pc, f"sensor desconhecido: {args[0]}")
+    if problems or not program:
+        return problems, 0
+
+    # Profundidade da pilha na entrada de cada instrução alcançável
+    depth: List[Optional[int]] = [None] * (len(program) + 1)  # +1: fim do programa
+    depth[0] = 0
+    work = [0]
+    max_depth = 0
+    while work and not problems:
+        pc = work.pop()
+        if pc == len(program):
+            continue
+        ins = program[pc]
+        pops, pushes = STACK_EFFECT[ins.op]
+        if pops is None:
+            pops = ins.count
+        d = depth[pc]
+        if d < pops:
+            problem(pc, f"pilha com {d} valor(es), precisa de {pops}")
+            break
+        d += pushes - pops
+        max_depth = max(max_depth, d)
+
+        successors = []
+        if ins.target is not None:
+            successors.append(ins.target)
+        if ins.op not in ("JUMP", "HALT"):
+            successors.append(pc + 1)
+        for nxt in successors:
+            if depth[nxt] is None:
+                depth[nxt] = d
+                work.append(nxt)
+            elif depth[nxt] != d:
+                problem(pc, f"chega ao PC={nxt} com {d} valor(es) na pilha, outro caminho com {depth[nxt]}")
+                break
+    if not problems and declared_stack is not None and declared_stack < max_depth:
+        problems.append(f".STACK {declared_stack} menor que a profundidade calculada ({max_depth})")
+    return problems, max_depth
+
+
 def stack_check(needed: int) -> bool:
     if len(stackVM) < needed:
         print(f"[VM] Erro: pilha com menos de {needed} elementos")
@@ -173,7 +401,214 @@ def is_truthy(v: Value) -> bool:
     return False
 
 
-def exec_program(program: List[Instruction], trace: bool = False) -> None:
+def read_input() -> Value:
+    """Lê uma linha da entrada e a converte em número, booleano ou texto."""
+    try:
+        line = input("> ")
+    except EOFError:
+        return Value.nil()
+    line = line.strip()
+    if line == "":
+        return Value.nil()
+    # tenta número
+    try:
+        num = float(line)
+        # se a string toda é número
+        if str(num) == line or line.replace(",", ".").replace(".", "", 1).isdigit():
+            return Value.from_num(num)
+        return Value.from_str(line)
+    except Exception:
+        if line in ("Verdadeiro", "Sim"):
+            return Value.from_bool(True)
+        if line in ("Falso", "Nao"):
+            return Value.from_bool(False)
+        return Value.from_str(line)
+
+
+class Profile:
+    """
+    Contadores do --profile-out, por instrução: execuções, quantas vezes a
+    condição de um salto condicional foi verdadeira e os tipos dos operandos
+    das operações binárias. O arquivo gravado agrega os contadores pelos
+    sites (.SITE) que o compilador marcou, que é o que --profile-use lê.
+    """
+
+    def __init__(self, size: int):
+        self.counts = [0] * size
+        self.truths = [0] * size
+        self.types: Dict[int, Dict[str, int]] = {}
+
+    def operand_types(self, pc: int, a: Value, b: Value) -> None:
+        seen = self.types.setdefault(pc, {})
+        key = f"{a.type}/{b.type}"
+        seen[key] = seen.get(key, 0) + 1
+
+    def write(self, filename: str, program: List[Instruction], source: str) -> None:
+        sites: Dict[str, List[int]] = {}
+        for pc, ins in enumerate(program):
+            for key in ins.sites or ():
+                total = sites.setdefault(key, [0, 0, 0])
+                total[0] += self.counts[pc]
+                if ins.op in ("JUMP_IF_FALSE", "JUMP_IF_TRUE"):
+                    total[1] += self.truths[pc]
+                    total[2] += self.counts[pc] - self.truths[pc]
+
+        with open(filename, "w", encoding="utf-8") as f:
+            f.write(f"# Perfil da SocraticVM: {source}\n")
+            if source_hash is not None:
+                # o compilador só usa o perfil com o mesmo fonte
+                f.write(f"source {source_hash}\n")
+            f.write("# site <chave> <execuções> <condição verdadeira> <condição falsa>\n")
+            for key, (count, true_count, false_count) in sites.items():
+                f.write(f"site {key} {count} {true_count} {false_count}\n")
+            f.write("# instr <pc> <op> <execuções> [<tipos>=<vezes> ...]\n")
+            for pc, ins in enumerate(program):
+                line = f"instr {pc} {ins.op} {self.counts[pc]}"
+                for key, count in sorted(self.types.get(pc, {}).items()):
+                    line += f" {key}={count}"
+                f.write(line + "\n")
+
+
+# Classe de cada instrução do .asm no --stats, como nas seções de
+# docs/SocraticVM.md
+OP_CLASSES = {
+    **dict.fromkeys(("PUSH_NUM", "PUSH_BOOL", "PUSH_STR", "PUSH_NIL"), "pilha"),
+    **dict.fromkeys(("LOAD", "LOAD_SLOT", "STORE", "STORE_SLOT"), "variáveis"),
+    **dict.fromkeys(("APPEND", "APPEND_SLOT", "STORE_INDEX", "STORE_INDEX_SLOT",
+                     "INDEX", "LEN", "BUILD_LIST"), "listas"),
+    **dict.fromkeys(("ADD", "SUB", "MUL", "DIV", "MOD"), "aritmética"),
+    **dict.fromkeys(("CMP_EQ", "CMP_NEQ", "CMP_LT", "CMP_LTE", "CMP_GT", "CMP_GTE"), "comparação"),
+    **dict.fromkeys(("AND", "OR"), "lógica"),
+    **dict.fromkeys(("JUMP", "JUMP_IF_FALSE", "JUMP_IF_TRUE", "HALT"), "controle"),
+    **dict.fromkeys(("MOV_TOP_R0", "MOV_TOP_R1", "PUSH_R0", "PUSH_R1"), "registradores"),
+    **dict.fromkeys(("QUESTION", "PRINT", "PRINT_CONCL", "INPUT", "INPUT_SLOT", "READ_SENSOR"), "E/S"),
+}
+
+# Instruções que dão valor a uma variável (as "variáveis criadas" do --stats)
+CREATING_OPS = ("STORE", "STORE_SLOT", "APPEND", "APPEND_SLOT",
+                "STORE_INDEX", "STORE_INDEX_SLOT", "INPUT", "INPUT_SLOT")
+
+
+class Stats:
+    """
+    Contadores do --stats: execuções e tempo de cada instrução, pilha máxima
+    e variáveis que receberam valor. O tempo entre duas instruções
+    observadas é cobrado da primeira, então inclui o custo da própria
+    observação: serve para comparar as classes entre si, não como tempo
+    absoluto.
+    """
+
+    def __init__(self, size: int, slot_count: int):
+        self.counts = [0] * size
+        self.times = [0.0] * size
+        self.created = [False] * slot_count
+        self.peak_depth = 0
+        self.last: Optional[int] = None
+        self.last_time = time.perf_counter()
+
+    def observe(self, pc: int, ins: Instruction, depth: int) -> None:
+        now = time.perf_counter()
+        if self.last is not None:
+            self.times[self.last] += now - self.last_time
+        self.last_time = now
+        self.last = pc
+        self.counts[pc] += 1
+        if depth > self.peak_depth:
+            self.peak_depth = depth
+        if ins.op in CREATING_OPS and ins.slot is not None:
+            self.created[ins.slot] = True
+
+    def finish(self) -> None:
+        # a última instrução recebe o tempo até aqui
+        if self.last is not None:
+            self.times[self.last] += time.perf_counter() - self.last_time
+        self.last = None
+
+    def print(self, out, program: List[Instruction], top: int) -> None:
+        def percent(part, total):
+            return 100.0 * part / total if total > 0 else 0.0
+
+        total = 0
+        elapsed = 0.0
+        by_op: Dict[str, int] = {}
+        by_class: Dict[str, List] = {}
+        for pc, count in enumerate(self.counts):
+            if not count:
+                continue
+            op = program[pc].op
+            total += count
+            elapsed += self.times[pc]
+            by_op[op] = by_op.get(op, 0) + count
+            c = by_class.setdefault(OP_CLASSES.get(op, "outras"), [0, 0.0])
+            c[0] += count
+            c[1] += self.times[pc]
+
+        print("[VM] Estatísticas da execução", file=out)
+        print(f"  instruções executadas: {total}", file=out)
+        print(f"  tempo nas instruções: {elapsed * 1000:.3f} ms", file=out)
+        print(f"  pilha máxima: {self.peak_depth}", file=out)
+        print(f"  variáveis criadas: {sum(self.created)} de {len(self.created)}", file=out)
+        # mais frequentes primeiro; empates em ordem alfabética
+        print("  execuções por opcode:", file=out)
+        for op, count in sorted(sorted(by_op.items()), key=lambda item: -item[1]):
+            print(f"    {op:<18} {count:12d} {percent(count, total):6.2f}%", file=out)
+        print("  tempo por classe:", file=out)
+        for name, (count, seconds) in sorted(sorted(by_class.items()), key=lambda item: -item[1][1]):
+            print(f"    {name:<14} {seconds * 1000:12.3f} ms {percent(seconds, elapsed):6.2f}%"
+                  f" {count:12d} instruções", file=out)
+        hot = sorted((pc for pc, count in enumerate(self.counts) if count), key=lambda pc: -self.counts[pc])
+        print("  instruções mais executadas:", file=out)
+        for pc in hot[:top]:
+            line = f"[PC={pc}] {program[pc].op}"
+            if program[pc].args:
+                line += " " + " ".join(program[pc].args)
+            print(f"    {self.counts[pc]:12d}  {line}", file=out)
+
+
+class Sampler:
+    """
+    Perfil por amostragem do --sample-out: a cada intervalo de tempo de CPU
+    (SIGPROF), o tratador do sinal anota o PC em que o laço de execução está,
+    lido do frame dele; a execução em si não muda nem fica mais lenta. O
+    arquivo gravado agrega as amostras pelas linhas do fonte (.LINE, com
+    -g no compilador), uma pilha "folded" por linha, o formato dos
+    geradores de flame graph.
+    """
+
+    def __init__(self, size: int, hz: int):
+        self.counts = [0] * size
+        self.interval = 1.0 / max(hz, 1)
+        self.loops = (exec_program.__code__, exec_verified.__code__)
+
+    def tick(self, signum, frame) -> None:
+        while frame is not None and frame.f_code not in self.loops:
+            frame = frame.f_back
+        if frame is not None:
+            pc = frame.f_locals.get("pc")
+            if isinstance(pc, int) and 0 <= pc < len(self.counts):
+                self.counts[pc] += 1
+
+    def start(self) -> None:
+        signal.signal(signal.SIGPROF, self.tick)
+        signal.setitimer(signal.ITIMER_PROF, self.interval, self.interval)
+
+    def stop(self) -> None:
+        signal.setitimer(signal.ITIMER_PROF, 0)
+
+    def write(self, filename: str, program: List[Instruction]) -> None:
+        # sem tabela de linhas, cada instrução é a sua própria pilha
+        stacks: Dict[str, int] = {}
+        for pc, count in enumerate(self.counts):
+            if count:
+                key = program[pc].lines or f"[PC={pc}] {program[pc].op}"
+                stacks[key] = stacks.get(key, 0) + count
+        with open(filename, "w", encoding="utf-8") as f:
+            for key in sorted(stacks):
+                f.write(f"{key} {stacks[key]}\n")
+
+
+def exec_program(program: List[Instruction], trace: bool = False,
+                 profile: Optional[Profile] = None, stats: Optional[Stats] = None) -> None:
     global reg0, reg1, start_time
 
     pc = 0
@@ -186,6 +621,12 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
         op = ins.op
         args = ins.args
 
+        if profile is not None:
+            profile.counts[pc] += 1
+
+        if stats is not None:
+            stats.observe(pc, ins, len(stackVM))
+
         if trace:
             debug_line = f"[PC={pc}] {op}"
             if args:
@@ -226,64 +667,53 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
             push(Value.nil())
             pc += 1
 
-        elif op == "LOAD":
-            if not args:
-                print("[VM] LOAD sem argumento")
+        elif op == "LOAD_SLOT" or op == "LOAD":
+            if ins.slot is None:
+                print(f"[VM] {op} sem argumento")
             else:
-                name = args[0]
-                v = variables.get(name, Value.nil())
-                push(v)
+                push(slots[ins.slot])
             pc += 1
 
-        elif op == "STORE":
-            if not args:
-                print("[VM] STORE sem argumento")
+        elif op == "STORE_SLOT" or op == "STORE":
+            if ins.slot is None:
+                print(f"[VM] {op} sem argumento")
             else:
                 if not stack_check(1):
                     return
-                v = pop()
-                name = args[0]
-                variables[name] = v
+                slots[ins.slot] = pop()
             pc += 1
 
-        elif op == "APPEND":
-            if not args:
-                print("[VM] APPEND sem argumento")
+        elif op == "APPEND_SLOT" or op == "APPEND":
+            if ins.slot is None:
+                print(f"[VM] {op} sem argumento")
             else:
                 if not stack_check(1):
                     return
                 v = pop()
-                name = args[0]
-                current = variables.get(name, Value.from_list([]))
+                current = slots[ins.slot]
                 if current.type != ValueType.LIST or current.list_val is None:
                     current = Value.from_list([])
+                    slots[ins.slot] = current
                 current.list_val.append(v)
-                variables[name] = current
             pc += 1
 
-        elif op == "STORE_INDEX":
-            if not args:
-                print("[VM] STORE_INDEX sem argumento")
+        elif op == "STORE_INDEX_SLOT" or op == "STORE_INDEX":
+            if ins.slot is None:
+                print(f"[VM] {op} sem argumento")
             else:
                 if not stack_check(2):
                     return
                 val = pop()
                 idx_v = pop()
-                name = args[0]
                 idx = int(idx_v.num_val)
-                current = variables.get(name)
-                if (
-                    current is None or
-                    current.type != ValueType.LIST or
-                    current.list_val is None
-                ):
-                    print(f"[VM] STORE_INDEX em variável não-lista: {name}")
+                current = slots[ins.slot]
+                if current.type != ValueType.LIST or current.list_val is None:
+                    print(f"[VM] STORE_INDEX em variável não-lista: {slot_names[ins.slot]}")
                 else:
                     if idx < 0 or idx >= len(current.list_val):
                         print("[VM] STORE_INDEX índice fora do intervalo")
                     else:
                         current.list_val[idx] = val
-                        variables[name] = current
             pc += 1
 
         elif op == "INDEX":
@@ -308,6 +738,8 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
                 return
             b = pop()
             a = pop()
+            if profile is not None:
+                profile.operand_types(pc, a, b)
             if op == "ADD":
                 if a.type == ValueType.STRING or b.type == ValueType.STRING:
                     push(Value.from_str(a.to_string() + b.to_string()))
@@ -332,6 +764,8 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
                 return
             b = pop()
             a = pop()
+            if profile is not None:
+                profile.operand_types(pc, a, b)
             res = False
             if op == "CMP_EQ":
                 if a.type == ValueType.NUMBER and b.type == ValueType.NUMBER:
@@ -359,6 +793,8 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
                 return
             b = pop()
             a = pop()
+            if profile is not None:
+                profile.operand_types(pc, a, b)
             if op == "AND":
                 push(Value.from_bool(is_truthy(a) and is_truthy(b)))
             else:
@@ -413,35 +849,11 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
             print(f"! {v.to_string()}")
             pc += 1
 
-        elif op == "INPUT":
-            if not args:
-                print("[VM] INPUT sem argumento")
+        elif op == "INPUT_SLOT" or op == "INPUT":
+            if ins.slot is None:
+                print(f"[VM] {op} sem argumento")
             else:
-                var_name = args[0]
-                try:
-                    line = input("> ")
-                except EOFError:
-                    variables[var_name] = Value.nil()
-                else:
-                    line = line.strip()
-                    if line == "":
-                        variables[var_name] = Value.nil()
-                    else:
-                        # tenta número
-                        try:
-                            num = float(line)
-                            # se a string toda é número
-                            if str(num) == line or line.replace(",", ".").replace(".", "", 1).isdigit():
-                                variables[var_name] = Value.from_num(num)
-                            else:
-                                variables[var_name] = Value.from_str(line)
-                        except Exception:
-                            if line in ("Verdadeiro", "Sim"):
-                                variables[var_name] = Value.from_bool(True)
-                            elif line in ("Falso", "Nao"):
-                                variables[var_name] = Value.from_bool(False)
-                            else:
-                                variables[var_name] = Value.from_str(line)
+                slots[ins.slot] = read_input()
             pc += 1
 
         elif op == "JUMP":
@@ -454,14 +866,16 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
                 return
             pc = labels[label]
 
-        elif op == "JUMP_IF_FALSE":
+        elif op == "JUMP_IF_FALSE" or op == "JUMP_IF_TRUE":
             if not args:
-                print("[VM] JUMP_IF_FALSE sem destino")
+                print(f"[VM] {op} sem destino")
                 return
             if not stack_check(1):
                 return
-            cond = pop()
-            if not is_truthy(cond):
+            truth = is_truthy(pop())
+            if profile is not None and truth:
+                profile.truths[pc] += 1
+            if truth == (op == "JUMP_IF_TRUE"):
                 label = args[0]
                 if label not in labels:
                     print(f"[VM] Label não encontrado: {label}")
@@ -513,18 +927,263 @@ def exec_program(program: List[Instruction], trace: bool = False) -> None:
             pc += 1
 
 
+def exec_verified(program: List[Instruction]) -> None:
+    """
+    Mesma semântica de exec_program para um programa que passou por
+    verify_program: a pilha nunca fica curta, os operandos existem e
+    já estão convertidos, e os saltos já têm destino. Sem trace nem perfil.
+    """
+    global reg0, reg1, start_time
+
+    stack = stackVM
+    push_v = stack.append
+    pop_v = stack.pop
+    pc = 0
+    n = len(program)
+    start_time = time.time()
+
+    while pc < n:
+        ins = program[pc]
+        op = ins.op
+
+        if op == "HALT":
+            break
+
+        elif op == "PUSH_NUM" or op == "PUSH_BOOL" or op == "PUSH_STR":
+            push_v(ins.value)
+
+        elif op == "PUSH_NIL":
+            push_v(Value.nil())
+
+        elif op == "LOAD_SLOT" or op == "LOAD":
+            push_v(slots[ins.slot])
+
+        elif op == "STORE_SLOT" or op == "STORE":
+            slots[ins.slot] = pop_v()
+
+        elif op == "APPEND_SLOT" or op == "APPEND":
+            v = pop_v()
+            current = slots[ins.slot]
+            if current.type != ValueType.LIST or current.list_val is None:
+                current = Value.from_list([])
+                slots[ins.slot] = current
+            current.list_val.append(v)
+
+        elif op == "STORE_INDEX_SLOT" or op == "STORE_INDEX":
+            val = pop_v()
+            idx = int(pop_v().num_val)
+            current = slots[ins.slot]
+            if current.type != ValueType.LIST or current.list_val is None:
+                print(f"[VM] STORE_INDEX em variável não-lista: {slot_names[ins.slot]}")
+            elif idx < 0 or idx >= len(current.list_val):
+                print("[VM] STORE_INDEX índice fora do intervalo")
+            else:
+                current.list_val[idx] = val
+
+        elif op == "INDEX":
+            idx_v = pop_v()
+            list_v = pop_v()
+            if list_v.type != ValueType.LIST or list_v.list_val is None:
+                print("[VM] INDEX aplicado em não-lista")
+                push_v(Value.nil())
+            else:
+                idx = int(idx_v.num_val)
+                if idx < 0 or idx >= len(list_v.list_val):
+                    print("[VM] INDEX índice fora do intervalo")
+                    push_v(Value.nil())
+                else:
+                    push_v(list_v.list_val[idx])
+
+        elif op == "ADD":
+            b = pop_v()
+            a = pop_v()
+            if a.type == ValueType.STRING or b.type == ValueType.STRING:
+                push_v(Value.from_str(a.to_string() + b.to_string()))
+            else:
+                push_v(Value.from_num(a.num_val + b.num_val))
+
+        elif op == "SUB":
+            b = pop_v()
+            stack[-1] = Value.from_num(stack[-1].num_val - b.num_val)
+
+        elif op == "MUL":
+            b = pop_v()
+            stack[-1] = Value.from_num(stack[-1].num_val * b.num_val)
+
+        elif op == "DIV":
+            b = pop_v()
+            if b.num_val == 0.0:
+                print("[VM] Divisão por zero")
+                stack[-1] = Value.from_num(0.0)
+            else:
+                stack[-1] = Value.from_num(stack[-1].num_val / b.num_val)
+
+        elif op == "MOD":
+            b = pop_v()
+            stack[-1] = Value.from_num(math.fmod(stack[-1].num_val, b.num_val))
+
+        elif op == "CMP_EQ" or op == "CMP_NEQ":
+            b = pop_v()
+            a = pop_v()
+            if a.type == ValueType.NUMBER and b.type == ValueType.NUMBER:
+                res = abs(a.num_val - b.num_val) < 1e-9
+            else:
+                res = a.to_string() == b.to_string()
+            push_v(Value.from_bool(res if op == "CMP_EQ" else not res))
+
+        elif op == "CMP_LT":
+            b = pop_v()
+            stack[-1] = Value.from_bool(stack[-1].num_val < b.num_val)
+
+        elif op == "CMP_LTE":
+            b = pop_v()
+            stack[-1] = Value.from_bool(stack[-1].num_val <= b.num_val)
+
+        elif op == "CMP_GT":
+            b = pop_v()
+            stack[-1] = Value.from_bool(stack[-1].num_val > b.num_val)
+
+        elif op == "CMP_GTE":
+            b = pop_v()
+            stack[-1] = Value.from_bool(stack[-1].num_val >= b.num_val)
+
+        elif op == "AND":
+            b = pop_v()
+            stack[-1] = Value.from_bool(is_truthy(stack[-1]) and is_truthy(b))
+
+        elif op == "OR":
+            b = pop_v()
+            stack[-1] = Value.from_bool(is_truthy(stack[-1]) or is_truthy(b))
+
+        elif op == "LEN":
+            v = stack[-1]
+            if v.type == ValueType.LIST and v.list_val is not None:
+                size = len(v.list_val)
+            elif v.type == ValueType.STRING:
+                size = len(v.str_val)
+            else:
+                size = 0
+            stack[-1] = Value.from_num(float(size))
+
+        elif op == "BUILD_LIST":
+            count = ins.count
+            if count:
+                temp = stack[-count:]
+                del stack[-count:]
+            else:
+                temp = []
+            push_v(Value.from_list(temp))
+
+        elif op == "QUESTION":
+            print(f"[?] {pop_v().to_string()}")
+
+        elif op == "PRINT":
+            print(f">> {pop_v().to_string()}")
+
+        elif op == "PRINT_CONCL":
+            print(f"! {pop_v().to_string()}")
+
+        elif op == "INPUT_SLOT" or op == "INPUT":
+            slots[ins.slot] = read_input()
+
+        elif op == "JUMP":
+            pc = ins.target
+            continue
+
+        elif op == "JUMP_IF_FALSE":
+            if not is_truthy(pop_v()):
+                pc = ins.target
+                continue
+
+        elif op == "JUMP_IF_TRUE":
+            if is_truthy(pop_v()):
+                pc = ins.target
+                continue
+
+        elif op == "MOV_TOP_R0":
+            reg0 = pop_v()
+
+        elif op == "MOV_TOP_R1":
+            reg1 = pop_v()
+
+        elif op == "PUSH_R0":
+            push_v(reg0)
+
+        elif op == "PUSH_R1":
+            push_v(reg1)
+
+        elif op == "READ_SENSOR":
+            if ins.args[0] == "time":
+                push_v(Value.from_num(time.time() - start_time))
+            else:
+                push_v(Value.from_num(random.random()))
+
+        pc += 1
+
+
 def main():
     if len(sys.argv) < 2:
-        print(f"Uso: {sys.argv[0]} programa.asm [--trace]")
+        print(f"Uso: {sys.argv[0]} programa.asm [--trace] [--profile-out=arquivo] [--verify]"
+              " [--sample-out=arquivo] [--sample-hz=N] [--stats[=N]]")
         sys.exit(1)
 
     filename = sys.argv[1]
     trace = False
-    if len(sys.argv) >= 3 and sys.argv[2] == "--trace":
-        trace = True
+    profile_out = None
+    sample_out = None
+    sample_hz = 1000
+    verify_only = False
+    stats_top = None   # --stats: quantas instruções mais executadas listar
+    for arg in sys.argv[2:]:
+        if arg == "--trace":
+            trace = True
+        elif arg.startswith("--profile-out="):
+            profile_out = arg[len("--profile-out="):]
+        elif arg.startswith("--sample-out="):
+            sample_out = arg[len("--sample-out="):]
+        elif arg.startswith("--sample-hz="):
+            sample_hz = int(arg[len("--sample-hz="):])
+        elif arg == "--verify":
+            verify_only = True
+        elif arg == "--stats":
+            stats_top = 10
+        elif arg.startswith("--stats="):
+            stats_top = int(arg[len("--stats="):])
 
     program = load_program(filename)
-    exec_program(program, trace)
+    problems, max_depth = verify_program(program)
+    if verify_only:
+        for p in problems:
+            print(f"[VM] {p}")
+        if problems:
+            print(f"[VM] Programa não verificado: {len(problems)} problema(s)")
+            sys.exit(1)
+        print(f"[VM] Programa verificado: {len(program)} instruções, pilha máxima {max_depth}")
+        return
+
+    sampler = Sampler(len(program), sample_hz) if sample_out else None
+    if sampler is not None:
+        sampler.start()
+    try:
+        # trace, perfil e --stats observam cada instrução, e um programa que
+        # não passou na verificação precisa das checagens: vão pelo laço
+        # completo
+        if not trace and not profile_out and stats_top is None and not problems:
+            exec_verified(program)
+            return
+        profile = Profile(len(program)) if profile_out else None
+        stats = Stats(len(program), len(slots)) if stats_top is not None else None
+        exec_program(program, trace, profile, stats)
+        if profile is not None:
+            profile.write(profile_out, program, filename)
+        if stats is not None:
+            stats.finish()
+            sys.stdout.flush()
+            stats.print(sys.stderr, program, stats_top)
+    finally:
+        if sampler is not None:
+            sampler.stop()
+            sampler.write(sample_out, program)
 
 
 if __name__ == "__main__":